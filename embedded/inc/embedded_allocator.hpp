@@ -11,12 +11,56 @@
 #ifndef EMBEDDED_TL_EMBEDDED_ALLOCATOR_HPP
 #define EMBEDDED_TL_EMBEDDED_ALLOCATOR_HPP
 
+#include <cstddef>
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <limits>
+#include <new>
+#include <utility>
 
 #include <embedded_types.hpp>
 #include <embedded_concepts.hpp>
+#include <embedded_lock.hpp>
 #include <embedded_utilities.hpp>
 
+/**
+ * @brief Places a static variable in a named linker section, no effect for host builds (UNIT_TEST).
+ * @param name Linker section name, string literal, ex: ".dtcm".
+ */
+#if !defined(UNIT_TEST) && (defined(__GNUC__) || defined(__clang__))
+#define EMBEDDED_SECTION_ATTRIBUTE(name) __attribute__((section(name)))
+#else
+#define EMBEDDED_SECTION_ATTRIBUTE(name)
+#endif
+
+/**
+ * @brief Defines a memory section type for basic_section_allocator<>.
+ * @param tag Section type name.
+ * @param section_name Linker section name, string literal, ex: ".dtcm", ".ccmram", ".dma_nocache".
+ * @param section_capacity Bytes reserved in the section.
+ * @param section_alignment Alignment of the reserved block.
+ * @param ... Object types placed in the section, see basic_section_allocator<>.
+ * @details
+ * The type owns a zero initialized block of section_capacity bytes placed in the linker section section_name, the
+ * linker script must map that section to the memory (ex: DTCM, CCM or a non-cacheable MPU region). For host builds
+ * (UNIT_TEST) the block is a separate static arena. The object list belongs to the section, so every allocator of the
+ * section uses the same layout and the capacity check covers the whole block.
+ */
+#define EMBEDDED_MEMORY_SECTION(tag, section_name, section_capacity, section_alignment, ...)                \
+  struct tag final {                                                                                         \
+    using objects = ::embtl::section_objects<__VA_ARGS__>;                                                   \
+    static constexpr const char* name = section_name;                                                        \
+    static constexpr std::size_t capacity = section_capacity;                                                \
+    static constexpr std::size_t alignment = section_alignment;                                              \
+    static std::byte* storage() noexcept {                                                                   \
+      EMBEDDED_SECTION_ATTRIBUTE(section_name) alignas(section_alignment) static std::byte block[section_capacity]; \
+      return block;                                                                                          \
+    }                                                                                                        \
+  }
+
 namespace embtl {
     /**
      * @brief Memory Mapped IO (MMIO) Device Information.
@@ -55,16 +99,202 @@ namespace embtl {
          * 'a' to 'z' or 'A' to 'Z', and the base parameter sets the base address of the memory mapped device.
          */
         constexpr memory_mapped_device_info(const char n, const address_t base) noexcept : number(char_to_index(n)), base_address(base) { }
+        /**
+         * @brief Construct list initializer for a numerically indexed device with a register map size.
+         * @param n [in] Device index number.
+         * @param base [in] Memory mapped device base address.
+         * @param size [in] Register map size in bytes, reserved by the host simulation arena.
+         * @note Only needed for register maps larger than the default host arena region (4 KiB), ex: {0_uz, 0x5000'0000, 0x2000}.
+         */
+        constexpr memory_mapped_device_info(const std::size_t n, const address_t base, const std::size_t size) noexcept
+          : number(n), base_address(base), register_size(size) { }
+        /**
+         * @brief Construct list initializer for an alpha character indexed device with a register map size.
+         * @param n [in] Character index := ['a'-'z'] or ['A' or 'Z']
+         * @param base [in] Memory mapped device base address.
+         * @param size [in] Register map size in bytes, reserved by the host simulation arena.
+         */
+        constexpr memory_mapped_device_info(const char n, const address_t base, const std::size_t size) noexcept
+          : number(char_to_index(n)), base_address(base), register_size(size) { }
 
         constexpr memory_mapped_device_info(const memory_mapped_device_info&) noexcept = default;
         constexpr memory_mapped_device_info& operator=(const memory_mapped_device_info&) noexcept = default;
         constexpr memory_mapped_device_info(memory_mapped_device_info&&) noexcept = default;
         constexpr memory_mapped_device_info& operator=(memory_mapped_device_info&&) noexcept = default;
 
-        std::size_t number;       /**< Memory mapped device index number. */
-        address_t base_address;   /**< Memory mapped device base address. */
+        std::size_t number;             /**< Memory mapped device index number. */
+        address_t base_address;         /**< Memory mapped device base address. */
+        std::size_t register_size = 0;  /**< Register map size, 0 := default host arena region size. */
     };
 
+    namespace details {
+        /**
+         * @brief Maximum span of device numbers stored in a dense table when no perfect hash is found.
+         */
+        inline constexpr std::size_t dense_device_table_max_span = 4096;
+        /**
+         * @brief Maximum perfect hash table size, relative to the first table size searched.
+         */
+        inline constexpr std::size_t hashed_device_table_max_growth = 64;
+        /**
+         * @brief Number of multipliers tried for each perfect hash table size.
+         */
+        inline constexpr std::size_t hashed_device_table_multipliers = 1024;
+
+        /**
+         * @brief Dense device lookup table, one base address per index between the smallest and largest device number.
+         * @tparam DeviceList Device configuration list.
+         */
+        template<memory_mapped_device_info ... DeviceList>
+        struct dense_device_table final {
+          public:
+            static constexpr std::size_t first = std::min({ DeviceList.number ... });
+            static constexpr std::size_t span = std::max({ DeviceList.number ... }) - first + 1;
+
+            static_assert(span <= dense_device_table_max_span,
+                          "Device numbers are too far apart: no collision free hash found and the dense table is too large.");
+            /**
+             * @brief Finds the base address of a device, a bounds check and one indexed load.
+             * @param n [in] Device number.
+             * @return If device number found, its base address, else 0.
+             */
+            static constexpr address_t find(const std::size_t n) noexcept {
+              const auto index = n - first;
+              return index < span ? addresses[index] : 0;
+            }
+
+          private:
+            static constexpr std::array<address_t, span> addresses = []() {
+              std::array<address_t, span> table { };
+              std::array<bool, span> used { };
+              for(const auto& device : { DeviceList ... }){
+                if(!used[device.number - first]){
+                  used[device.number - first] = true;
+                  table[device.number - first] = device.base_address;
+                }
+              }
+              return table;
+            }();
+        };
+
+        /**
+         * @brief Perfect hash device lookup table, for device numbers that are far apart.
+         * @tparam DeviceList Device configuration list.
+         * @details
+         * The slot of a device number is (number * multiplier) >> shift, the multiplier is searched at compile time so
+         * that no two device numbers share a slot. Each slot stores the device number to reject numbers not in the list.
+         * The search is bounded, parameters.size is 0 if no multiplier is found, device_table<> then uses the dense
+         * table.
+         */
+        template<memory_mapped_device_info ... DeviceList>
+        struct hashed_device_table final {
+          private:
+            struct slot_type {
+                std::size_t number;
+                address_t base_address;
+            };
+
+          public:
+            struct hash_parameters {
+                std::size_t size;
+                std::size_t multiplier;
+            };
+
+          private:
+
+            static constexpr std::size_t empty_slot = std::numeric_limits<std::size_t>::max();
+
+            static constexpr std::size_t slot_of(const std::size_t n, const std::size_t multiplier, const std::size_t size) noexcept {
+              return (n * multiplier) >> (std::numeric_limits<std::size_t>::digits - std::countr_zero(size));
+            }
+
+            static consteval bool collision_free(const std::size_t multiplier, const std::size_t size) noexcept {
+              std::array<std::size_t, sizeof...(DeviceList)> slots { slot_of(DeviceList.number, multiplier, size) ... };
+              std::array<std::size_t, sizeof...(DeviceList)> numbers { DeviceList.number ... };
+              for(std::size_t i = 0; i < slots.size(); ++i){
+                for(std::size_t j = i + 1; j < slots.size(); ++j){
+                  if(slots[i] == slots[j] && numbers[i] != numbers[j]){
+                    return false;
+                  }
+                }
+              }
+              return true;
+            }
+
+            static consteval hash_parameters find_parameters() noexcept {
+              constexpr auto golden_ratio = static_cast<std::size_t>(0x9E37'79B9'7F4A'7C15ULL);
+
+              const auto first_size = std::bit_ceil(4 * sizeof...(DeviceList));
+
+              for(auto size = first_size; size <= hashed_device_table_max_growth * first_size; size *= 2){
+                for(std::size_t k = 0; k < hashed_device_table_multipliers; ++k){
+                  const auto multiplier = golden_ratio + 2 * k;
+                  if(collision_free(multiplier, size)){
+                    return { size, multiplier };
+                  }
+                }
+              }
+              return { 0, 0 };
+            }
+
+          public:
+            static constexpr hash_parameters parameters = find_parameters();
+            /**
+             * @brief Finds the base address of a device, one multiply, one indexed load and one compare.
+             * @param n [in] Device number.
+             * @return If device number found, its base address, else 0.
+             */
+            static constexpr address_t find(const std::size_t n) noexcept {
+              const auto& slot = slots[slot_of(n, parameters.multiplier, parameters.size)];
+              return slot.number == n ? slot.base_address : 0;
+            }
+
+          private:
+            static constexpr std::array<slot_type, parameters.size> slots = []() {
+              std::array<slot_type, parameters.size> table { };
+              for(auto& slot : table){
+                slot = { empty_slot, 0 };
+              }
+              for(const auto& device : { DeviceList ... }){
+                auto& slot = table[slot_of(device.number, parameters.multiplier, parameters.size)];
+                if(slot.number == empty_slot){
+                  slot = { device.number, device.base_address };
+                }
+              }
+              return table;
+            }();
+        };
+
+        /**
+         * @brief Maximum span of device numbers, relative to the number of devices, stored in a dense table.
+         */
+        inline constexpr std::size_t dense_device_table_ratio = 4;
+        /**
+         * @brief Device numbers spans up to this size are always stored in a dense table.
+         */
+        inline constexpr std::size_t dense_device_table_span = 32;
+
+        template<memory_mapped_device_info ... DeviceList>
+        consteval bool use_dense_device_table() noexcept {
+          const auto span = std::max({ DeviceList.number ... }) - std::min({ DeviceList.number ... }) + 1;
+          if(span <= std::max(dense_device_table_span, dense_device_table_ratio * sizeof...(DeviceList))){
+            return true;
+          }
+          return hashed_device_table<DeviceList...>::parameters.size == 0;
+        }
+    }
+
+    /**
+     * @brief Device lookup table of a device list, a dense table if the device numbers are close together, otherwise
+     *        a perfect hash table.
+     * @tparam DeviceList Device configuration list.
+     */
+    template<memory_mapped_device_info ... DeviceList>
+    requires (sizeof...(DeviceList) > 0)
+    using device_table = std::conditional_t<details::use_dense_device_table<DeviceList...>(),
+                                            details::dense_device_table<DeviceList...>,
+                                            details::hashed_device_table<DeviceList...>>;
+
     /**
      * @brief Finds base address in list of Device memory configurations.
      * @tparam Device First Device configuration.
@@ -76,15 +306,7 @@ namespace embtl {
      */
     template<memory_mapped_device_info Device, memory_mapped_device_info ... DeviceList>
     consteval address_t find_base_address(const std::size_t n = 0) noexcept {
-      if (n == Device.number){
-        return Device.base_address;
-      } else {
-        if constexpr (sizeof...(DeviceList) > 0){
-          return find_base_address<DeviceList...>(n);
-        } else {
-          return 0;
-        }
-      }
+      return device_table<Device, DeviceList...>::find(n);
     }
 
     /**
@@ -95,6 +317,10 @@ namespace embtl {
      * @return If sucessuful a pointer to MMIO device register map base address. If the number is not
      * found a nullptr is returned.
      *
+     * @details
+     * The device list is compiled into a device_table<>, the lookup is a bounds check and one indexed load, or one
+     * multiply, one indexed load and one compare for sparse device numbers.
+     *
      * @example
      * - Device registers new operator overload.
      * @code{.cpp}
@@ -116,15 +342,8 @@ namespace embtl {
      */
     template<memory_mapped_device_info Device, memory_mapped_device_info ... DeviceList>
     void* basic_mmio_device_allocator(const std::size_t n = 0) noexcept {
-      if(n == Device.number){
-        return reinterpret_cast<void*>(Device.base_address);
-      } else {
-        if constexpr(sizeof...(DeviceList) > 0){
-          return basic_mmio_device_allocator<DeviceList...>(n);
-        } else {
-          return nullptr;
-        }
-      }
+      const auto base_address = device_table<Device, DeviceList...>::find(n);
+      return base_address == 0 ? nullptr : reinterpret_cast<void*>(base_address);
     }
 
 
@@ -153,6 +372,267 @@ namespace embtl {
         static void deallocate([[maybe_unused]]void* ptr) noexcept { }
     };
 
+    namespace details {
+        /**
+         * @brief Default host arena region size reserved after the highest base address, and per device when packed.
+         *        Devices with a larger register_size reserve their register_size.
+         */
+        inline constexpr std::size_t host_arena_region_size = 0x1000;
+        /**
+         * @brief Largest address span mirrored by a host arena, larger device lists are packed. Kept small because
+         *        every device list has its own arena in static storage.
+         */
+        inline constexpr std::size_t host_arena_max_span = 0x0001'0000;
+        /**
+         * @brief Host arena storage alignment, one page.
+         */
+        inline constexpr std::size_t host_arena_alignment = 0x1000;
+
+        /**
+         * @brief Host simulation arena of a device list, one static block serving every device without heap allocation.
+         * @tparam DeviceList Device configuration list.
+         * @details
+         * If the device base addresses are within host_arena_max_span, the block mirrors the memory map: the device
+         * registers are at their real offset from the lowest base address, devices sharing registers on the target
+         * share them on the host. Otherwise each distinct base address gets a slot, in address order. The region of a
+         * device is its register_size, at least host_arena_region_size; the packed slot size is the largest region
+         * rounded up to host_arena_region_size. The block is zero initialized and lives for the whole program,
+         * deallocate is a no-op.
+         */
+        template<memory_mapped_device_info ... DeviceList>
+        struct host_arena final {
+          private:
+            static constexpr std::size_t count = sizeof...(DeviceList);
+            static constexpr std::array<address_t, count> addresses = []() {
+              std::array<address_t, count> table { DeviceList.base_address ... };
+              std::sort(table.begin(), table.end());
+              return table;
+            }();
+
+            static constexpr std::size_t region_of(const memory_mapped_device_info& device) noexcept {
+              return std::max(device.register_size, host_arena_region_size);
+            }
+
+          public:
+            static constexpr address_t first_address = addresses.front();
+            static constexpr std::size_t address_span = std::max({ (DeviceList.base_address - first_address + region_of(DeviceList)) ... });
+            static constexpr std::size_t slot_size = (std::max({ region_of(DeviceList) ... }) + host_arena_region_size - 1) /
+                                                     host_arena_region_size * host_arena_region_size;
+            static constexpr bool mirrored = address_span <= host_arena_max_span;
+            static constexpr std::size_t size = mirrored ? address_span : count * slot_size;
+            /**
+             * @brief Offset of a device base address in the arena.
+             * @param base_address [in] Device base address, from the device list.
+             * @return Byte offset in the arena.
+             */
+            static constexpr std::size_t offset(const address_t base_address) noexcept {
+              if constexpr (mirrored){
+                return base_address - first_address;
+              } else {
+                const auto slot = std::lower_bound(addresses.begin(), addresses.end(), base_address) - addresses.begin();
+                return static_cast<std::size_t>(slot) * slot_size;
+              }
+            }
+            /**
+             * @brief Gets the host registers of a device.
+             * @param sz [in] Register map size.
+             * @param n [in] Device number. (default = 0)
+             * @return Pointer in the arena, nullptr if the device number is not in the list or the register map does
+             *         not fit the arena.
+             */
+            static void* allocate(const std::size_t sz, const std::size_t n = 0) noexcept {
+              const auto base_address = device_table<DeviceList...>::find(n);
+              if(base_address == 0){
+                return nullptr;
+              }
+              const auto start = offset(base_address);
+              const auto limit = mirrored ? size : start + slot_size;
+              return sz > limit - start ? nullptr : static_cast<void*>(storage + start);
+            }
+
+          private:
+            alignas(host_arena_alignment) static inline std::byte storage[size] { };
+        };
+    }
+
+    namespace details {
+        template<typename Sequence, memory_mapped_device_info ... DeviceList>
+        struct device_position_table;
+
+        template<std::size_t ... Position, memory_mapped_device_info ... DeviceList>
+        struct device_position_table<std::index_sequence<Position...>, DeviceList...> {
+            using type = device_table<memory_mapped_device_info { DeviceList.number, static_cast<address_t>(Position + 1) } ...>;
+        };
+
+        /**
+         * @brief Word shared between threads, cores and interrupt handlers, atomic when the target has lock-free word
+         *        atomics, otherwise every access is made in a PRIMASK critical section.
+         * @tparam Word Unsigned integer type.
+         * @tparam LockFree true := std::atomic<Word>, false := critical section. (default = std::atomic<Word>::is_always_lock_free)
+         * @details
+         * ARMv6-M (Cortex-M0/M0+) has no exclusive load/store, std::atomic<> read-modify-writes are not lock-free and
+         * need library support. The critical section fallback keeps the same interface, it is interrupt safe on single
+         * core targets. The memory order arguments are only used by the atomic word.
+         */
+        template<std::unsigned_integral Word, bool LockFree = std::atomic<Word>::is_always_lock_free>
+        struct interrupt_safe_word final {
+          public:
+            constexpr interrupt_safe_word() noexcept = default;
+            constexpr interrupt_safe_word(const Word initial) noexcept : word{initial} { }
+
+            Word load(const std::memory_order order) const noexcept {
+              if constexpr (LockFree){
+                return word.load(order);
+              } else {
+                const auto state = lock::primask_lock::lock();
+                const auto value = word;
+                lock::primask_lock::unlock(state);
+                return value;
+              }
+            }
+            void store(const Word value, const std::memory_order order) noexcept {
+              if constexpr (LockFree){
+                word.store(value, order);
+              } else {
+                const auto state = lock::primask_lock::lock();
+                word = value;
+                lock::primask_lock::unlock(state);
+              }
+            }
+            Word fetch_or(const Word mask, const std::memory_order order) noexcept {
+              if constexpr (LockFree){
+                return word.fetch_or(mask, order);
+              } else {
+                const auto state = lock::primask_lock::lock();
+                const auto previous = word;
+                word = static_cast<Word>(previous | mask);
+                lock::primask_lock::unlock(state);
+                return previous;
+              }
+            }
+            Word fetch_and(const Word mask, const std::memory_order order) noexcept {
+              if constexpr (LockFree){
+                return word.fetch_and(mask, order);
+              } else {
+                const auto state = lock::primask_lock::lock();
+                const auto previous = word;
+                word = static_cast<Word>(previous & mask);
+                lock::primask_lock::unlock(state);
+                return previous;
+              }
+            }
+            bool compare_exchange_weak(Word& expected, const Word desired, const std::memory_order success, const std::memory_order failure) noexcept {
+              if constexpr (LockFree){
+                return word.compare_exchange_weak(expected, desired, success, failure);
+              } else {
+                const auto state = lock::primask_lock::lock();
+                const auto current = word;
+                if(current == expected){
+                  word = desired;
+                }
+                lock::primask_lock::unlock(state);
+                const auto exchanged = current == expected;
+                expected = current;
+                return exchanged;
+              }
+            }
+
+          private:
+            std::conditional_t<LockFree, std::atomic<Word>, Word> word { };
+        };
+
+        /**
+         * @brief Device claim bitmap of a device list, one bit per device in list order.
+         * @tparam DeviceList Device configuration list.
+         * @details
+         * A device is claimed with one fetch_or and released with one fetch_and on the word holding its bit, claims
+         * never wait and never take a lock, so devices can be acquired concurrently from threads, cores or interrupt
+         * handlers. Without lock-free word atomics (ARMv6-M) the words are updated in a PRIMASK critical section, see
+         * interrupt_safe_word<>. The device number to bit lookup is a device_table<> of the list positions.
+         */
+        template<memory_mapped_device_info ... DeviceList>
+        struct device_claims final {
+          private:
+            using word_type = std::uintptr_t;
+
+            static constexpr std::size_t word_bits = std::numeric_limits<word_type>::digits;
+            static constexpr std::size_t count = sizeof...(DeviceList);
+
+            using position_table = typename device_position_table<std::make_index_sequence<count>, DeviceList...>::type;
+
+          public:
+            static constexpr std::array<std::size_t, count> numbers { DeviceList.number ... };
+            /**
+             * @brief Finds the claim bit of a device.
+             * @param n [in] Device number.
+             * @return Position of the device in the list, count if the device number is not in the list.
+             */
+            static constexpr std::size_t position(const std::size_t n) noexcept {
+              const auto position = position_table::find(n);
+              return position == 0 ? count : position - 1;
+            }
+            /**
+             * @brief Claims a device.
+             * @param n [in] Device number.
+             * @return STATUS::OK := device claimed; STATUS::NOT_AVAILABLE := device already claimed;
+             *         STATUS::INVALID_PARAMETER := device number not in the list.
+             */
+            static STATUS claim(const std::size_t n) noexcept {
+              const auto bit = position(n);
+              if(bit == count){
+                return STATUS::INVALID_PARAMETER;
+              }
+              const auto mask = word_type{1} << (bit % word_bits);
+              const auto previous = words[bit / word_bits].fetch_or(mask, std::memory_order_acquire);
+              return (previous & mask) == 0 ? STATUS::OK : STATUS::NOT_AVAILABLE;
+            }
+            /**
+             * @brief Releases a device, no effect if the device is not claimed.
+             * @param n [in] Device number.
+             */
+            static void release(const std::size_t n) noexcept {
+              release_position(position(n));
+            }
+            /**
+             * @brief Releases the device at a list position.
+             * @param bit [in] Position of the device in the list.
+             */
+            static void release_position(const std::size_t bit) noexcept {
+              if(bit < count){
+                words[bit / word_bits].fetch_and(~(word_type{1} << (bit % word_bits)), std::memory_order_release);
+              }
+            }
+            /**
+             * @brief Checks if a device is claimed.
+             * @param n [in] Device number.
+             * @return true := device claimed.
+             */
+            static bool is_claimed(const std::size_t n) noexcept {
+              const auto bit = position(n);
+              return bit < count && (words[bit / word_bits].load(std::memory_order_acquire) & (word_type{1} << (bit % word_bits))) != 0;
+            }
+            /**
+             * @brief Calls f(position) for each claimed device, until f returns true.
+             * @param f [in] Callable, bool(std::size_t).
+             * @return true := f returned true.
+             */
+            template<typename F>
+            static bool find_claimed(F&& f) noexcept {
+              for(std::size_t word = 0; word < words.size(); ++word){
+                for(auto bits = words[word].load(std::memory_order_acquire); bits != 0; bits &= bits - 1){
+                  if(f(word * word_bits + static_cast<std::size_t>(std::countr_zero(bits)))){
+                    return true;
+                  }
+                }
+              }
+              return false;
+            }
+
+          private:
+            static inline std::array<interrupt_safe_word<word_type>, (count + word_bits - 1) / word_bits> words { };
+        };
+    }
+
     /**
      * @brief Templated Memory Mapped IO (MMIO) device list allocator class.
      * @tparam IndexType Indicates if the index type is a character (char) or number (std::size_t).
@@ -168,6 +648,10 @@ namespace embtl {
      * memory mapped device registers base address for the index requested. If the index is not part of the list provided
      * a nullptr will be returned.
      *
+     * Each device has one owner: allocate() claims the device and returns nullptr if the device is already claimed,
+     * deallocate() releases it. The claims are a lock-free bitmap, see details::device_claims<>. claim() and release()
+     * give the same ownership without the register pointer.
+     *
      * @example
      * UART device list and GPIO port list allocator.
      *
@@ -183,20 +667,69 @@ namespace embtl {
     template<bool_integral_constant HostAlloc, memory_mapped_device_info ... DeviceList>
     requires (sizeof...(DeviceList) > 1)
     struct basic_mmio_device_list_allocator final {
-      public:
-        static void* allocate([[maybe_unused]]std::size_t sz, const std::size_t n) noexcept {
+      private:
+        using claims = details::device_claims<DeviceList...>;
+
+        static void* registers([[maybe_unused]]const std::size_t sz, const std::size_t n) noexcept {
           if constexpr (HostAlloc::value){
-            return std::malloc(sz);
+            return details::host_arena<DeviceList...>::allocate(sz, n);
           } else {
             return basic_mmio_device_allocator<DeviceList...>(n);
           }
         }
 
-        static void deallocate([[maybe_unused]]void* ptr) noexcept {
-          if constexpr (HostAlloc::value){
-            std::free(ptr);
+      public:
+        /**
+         * @brief Claims a device and gets its registers.
+         * @param sz [in] Register map size.
+         * @param n [in] Device number.
+         * @return Pointer to the device registers, nullptr if the device number is not in the list or the device is
+         *         already claimed.
+         */
+        static void* allocate(const std::size_t sz, const std::size_t n) noexcept {
+          if(claims::claim(n) != STATUS::OK){
+            return nullptr;
+          }
+          auto* const ptr = registers(sz, n);
+          if(ptr == nullptr){
+            claims::release(n);
           }
+          return ptr;
         }
+        /**
+         * @brief Releases the claimed device whose registers are at ptr.
+         * @param ptr [in] Pointer from allocate(), nullptr is ignored.
+         * @note If several claimed devices share the same registers, the first one in list order is released.
+         */
+        static void deallocate(void* ptr) noexcept {
+          if(ptr != nullptr){
+            claims::find_claimed([ptr](const std::size_t position){
+              if(registers(0, claims::numbers[position]) != ptr){
+                return false;
+              }
+              claims::release_position(position);
+              return true;
+            });
+          }
+        }
+        /**
+         * @brief Claims a device without getting its registers.
+         * @param n [in] Device number.
+         * @return STATUS::OK := device claimed; STATUS::NOT_AVAILABLE := device already claimed;
+         *         STATUS::INVALID_PARAMETER := device number not in the list.
+         */
+        static STATUS claim(const std::size_t n) noexcept { return claims::claim(n); }
+        /**
+         * @brief Releases a device.
+         * @param n [in] Device number.
+         */
+        static void release(const std::size_t n) noexcept { claims::release(n); }
+        /**
+         * @brief Checks if a device is claimed.
+         * @param n [in] Device number.
+         * @return true := device claimed.
+         */
+        static bool is_claimed(const std::size_t n) noexcept { return claims::is_claimed(n); }
     };
 
     /**
@@ -224,17 +757,288 @@ namespace embtl {
       public:
         static void* allocate([[maybe_unused]]std::size_t sz) noexcept {
           if constexpr (HostAlloc::value){
-            return std::malloc(sz);
+            return details::host_arena<Device>::allocate(sz, Device.number);
           } else {
             return basic_mmio_device_allocator<Device>();
           }
         }
 
-        static void deallocate([[maybe_unused]]void* ptr) noexcept {
-          if constexpr (HostAlloc::value){
-            std::free(ptr);
+        static void deallocate([[maybe_unused]]void* ptr) noexcept { }
+    };
+
+    /**
+     * @brief Fixed capacity object pool allocator, N slots of T in static storage with a lock-free free list.
+     * @tparam T Slot object type, the slot size and alignment.
+     * @tparam N Number of slots.
+     * @details
+     * The pool has the static allocate(std::size_t)/deallocate(void*) interface of the MMIO allocators and can be used
+     * in the operator new/delete overloads of drivers, request descriptors or message buffers. Both methods are O(1)
+     * and lock-free, they can be called from interrupt handlers and from several threads.
+     *
+     * Slots are first handed out in order, released slots are kept in a free list (Treiber stack). The free list head
+     * packs a slot index and a modification tag in one atomic word, the tag changes on every push and pop so a stale
+     * head is not accepted by compare-exchange (ABA).
+     *
+     * @note The head word is half index, half tag: 16 bit index on 32-bit targets, N must be less than 65535. Without
+     * lock-free word atomics (Cortex-M0/M0+) the free list words are updated in a PRIMASK critical section, the pool
+     * is then interrupt safe but not lock-free.
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  struct dma_request {
+     *    ...
+     *    static void* operator new(std::size_t sz) noexcept { return embtl::basic_pool_allocator<dma_request, 8>::allocate(sz); }
+     *    static void operator delete(void* ptr) noexcept { embtl::basic_pool_allocator<dma_request, 8>::deallocate(ptr); }
+     *  };
+     *
+     *  auto* request = new dma_request { ... };  // nullptr when the 8 requests are in use.
+     *
+     * @endcode
+     *
+     * @note Unit Tested.
+     */
+    template<typename T, std::size_t N>
+    requires (N > 0 && std::is_object_v<T>)
+    struct basic_pool_allocator final {
+      private:
+        using head_type = std::uintptr_t;
+        using index_type = std::uint32_t;
+
+        static constexpr std::size_t index_bits = std::numeric_limits<head_type>::digits / 2;
+        static constexpr head_type index_mask = (head_type{1} << index_bits) - 1;
+        static constexpr index_type npos = static_cast<index_type>(index_mask);
+
+        static_assert(N < npos, "Pool has too many slots for the free list index.");
+
+        static constexpr index_type index_of(const head_type head) noexcept { return static_cast<index_type>(head & index_mask); }
+        static constexpr head_type make_head(const index_type index, const head_type previous) noexcept {
+          return (((previous >> index_bits) + 1) << index_bits) | index;
+        }
+
+      public:
+        static constexpr std::size_t slot_size = sizeof(T);
+
+        static constexpr std::size_t capacity() noexcept { return N; }
+        /**
+         * @brief Takes one slot.
+         * @param sz [in] Object size, at most sizeof(T).
+         * @return Pointer to an uninitialized slot, nullptr if all the slots are in use or sz is too large.
+         */
+        static void* allocate(const std::size_t sz = sizeof(T)) noexcept {
+          if(sz > sizeof(T)){
+            return nullptr;
+          }
+
+          auto head = free_head.load(std::memory_order_acquire);
+          while(index_of(head) != npos){
+            const auto next = links[index_of(head)].load(std::memory_order_relaxed);
+            if(free_head.compare_exchange_weak(head, make_head(next, head), std::memory_order_acquire, std::memory_order_acquire)){
+              return slots[index_of(head)];
+            }
+          }
+
+          auto fresh = unused.load(std::memory_order_relaxed);
+          while(fresh < N){
+            if(unused.compare_exchange_weak(fresh, fresh + 1, std::memory_order_relaxed, std::memory_order_relaxed)){
+              return slots[fresh];
+            }
+          }
+          return nullptr;
+        }
+        /**
+         * @brief Returns one slot to the pool.
+         * @param ptr [in] Pointer from allocate(), nullptr is ignored.
+         * @note The object in the slot must be destroyed by the caller, ex: delete.
+         */
+        static void deallocate(void* ptr) noexcept {
+          if(!owns(ptr)){
+            return;
           }
+          const auto index = static_cast<index_type>((reinterpret_cast<std::uintptr_t>(ptr) - reinterpret_cast<std::uintptr_t>(slots[0])) / sizeof(T));
+
+          auto head = free_head.load(std::memory_order_relaxed);
+          do {
+            links[index].store(index_of(head), std::memory_order_relaxed);
+          } while(!free_head.compare_exchange_weak(head, make_head(index, head), std::memory_order_release, std::memory_order_relaxed));
+        }
+        /**
+         * @brief Checks if a pointer is a slot of this pool.
+         * @param ptr [in] Pointer to be checked.
+         * @return true := ptr is the start of a slot.
+         */
+        static bool owns(const void* ptr) noexcept {
+          const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+          const auto first = reinterpret_cast<std::uintptr_t>(slots[0]);
+          return address >= first && address < first + N * sizeof(T) && (address - first) % sizeof(T) == 0;
         }
+
+      private:
+        alignas(T) static inline std::byte slots[N][sizeof(T)] { };
+        static inline details::interrupt_safe_word<index_type> links[N] { };
+        static inline details::interrupt_safe_word<head_type> free_head { npos };
+        static inline details::interrupt_safe_word<index_type> unused { 0 };
+    };
+
+    /**
+     * @brief Buffer of N elements with a minimum alignment, ex: DMA buffers aligned to the cache line.
+     * @tparam T Element type.
+     * @tparam N Number of elements.
+     * @tparam Alignment Buffer alignment. (default = alignof(T))
+     */
+    template<typename T, std::size_t N, std::size_t Alignment = alignof(T)>
+    requires (N > 0 && std::has_single_bit(Alignment) && Alignment >= alignof(T))
+    struct alignas(Alignment) aligned_buffer {
+      public:
+        using value_type = T;
+
+        static constexpr std::size_t size() noexcept { return N; }
+
+        constexpr T& operator[](const std::size_t i) noexcept { return data[i]; }
+        constexpr const T& operator[](const std::size_t i) const noexcept { return data[i]; }
+
+        T data[N];
+    };
+
+    /**
+     * @brief Object types placed in a memory section, see EMBEDDED_MEMORY_SECTION.
+     * @tparam Objects Object types, each type once.
+     */
+    template<typename ... Objects>
+    struct section_objects final { };
+
+    /**
+     * @brief Memory section allocator, places the objects of a memory section in its block.
+     * @tparam Section Memory section type, see EMBEDDED_MEMORY_SECTION.
+     * @tparam ObjectList Object types placed in the section. (default = Section::objects)
+     * @details
+     * The object offsets are computed at compile time, in the order given to EMBEDDED_MEMORY_SECTION, each object
+     * aligned to its type. A compile time error is generated if the objects do not fit the section capacity or need a
+     * larger alignment than the section block. The slots are not constructed, use construct<T>() or the allocate<T>()
+     * method from an operator new overload. deallocate() is a no-op, the objects live for the whole program.
+     *
+     * @note The object list is part of the section type, all the allocators of a section share one layout.
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  using adc_buffer_t = embtl::aligned_buffer<std::uint16_t, 256, 32>;
+     *  EMBEDDED_MEMORY_SECTION(dtcm_section, ".dtcm", 16 * 1024, 8, pid_state, filter_state);
+     *  EMBEDDED_MEMORY_SECTION(dma_section, ".dma_nocache", 4 * 1024, 32, adc_buffer_t);
+     *
+     *  using dtcm_allocator_t = embtl::basic_section_allocator<dtcm_section>;
+     *  using dma_allocator_t = embtl::basic_section_allocator<dma_section>;
+     *
+     *  auto* pid = dtcm_allocator_t::construct<pid_state>(kp, ki, kd);
+     *  auto* adc_samples = dma_allocator_t::get<adc_buffer_t>();
+     *
+     * @endcode
+     *
+     * @note Unit Tested.
+     */
+    template<memory_section Section, typename ObjectList = typename Section::objects>
+    struct basic_section_allocator;
+
+    template<memory_section Section, typename ... Objects>
+    requires (sizeof...(Objects) > 0 && (std::is_object_v<Objects> && ...))
+    struct basic_section_allocator<Section, section_objects<Objects ...>> final {
+      private:
+        static constexpr std::size_t count = sizeof...(Objects);
+        static constexpr std::array<std::size_t, count> sizes { sizeof(Objects) ... };
+        static constexpr std::array<std::size_t, count> alignments { alignof(Objects) ... };
+
+        static constexpr std::array<std::size_t, count + 1> offsets = []() {
+          std::array<std::size_t, count + 1> table { };
+          std::size_t offset = 0;
+          for(std::size_t i = 0; i < count; ++i){
+            offset = (offset + alignments[i] - 1) & ~(alignments[i] - 1);
+            table[i] = offset;
+            offset += sizes[i];
+          }
+          table[count] = offset;
+          return table;
+        }();
+
+        template<typename T>
+        static constexpr std::size_t index_of() noexcept {
+          constexpr std::array<bool, count> match { std::is_same_v<T, Objects> ... };
+          std::size_t index = 0;
+          while(index < count && !match[index]){
+            ++index;
+          }
+          return index;
+        }
+
+        static consteval bool unique_objects() noexcept {
+          constexpr std::array<std::size_t, count> first { index_of<Objects>() ... };
+          for(std::size_t i = 0; i < count; ++i){
+            if(first[i] != i){
+              return false;
+            }
+          }
+          return true;
+        }
+
+        static_assert(unique_objects(), "Each object type can be placed once in a memory section.");
+        static_assert(std::is_same_v<section_objects<Objects ...>, typename Section::objects>, "Objects must be the memory section objects.");
+
+      public:
+        using section = Section;
+
+        /**
+         * @brief Bytes used by the objects, including alignment padding.
+         */
+        static constexpr std::size_t used = offsets[count];
+        /**
+         * @brief Bytes left in the section.
+         */
+        static constexpr std::size_t available = Section::capacity - used;
+
+        static_assert(used <= Section::capacity, "Objects do not fit the memory section.");
+        static_assert(std::max({ alignof(Objects) ... }) <= Section::alignment, "Object alignment is larger than the memory section alignment.");
+
+        /**
+         * @brief Offset of an object in the section.
+         * @tparam T Object type, one of Objects.
+         * @return Byte offset.
+         */
+        template<typename T>
+        requires (std::is_same_v<T, Objects> || ...)
+        static constexpr std::size_t offset() noexcept { return offsets[index_of<T>()]; }
+        /**
+         * @brief Gets the slot of an object, the object is not constructed.
+         * @tparam T Object type, one of Objects.
+         * @return Pointer to the slot.
+         */
+        template<typename T>
+        requires (std::is_same_v<T, Objects> || ...)
+        static T* get() noexcept {
+          return reinterpret_cast<T*>(Section::storage() + offset<T>());
+        }
+        /**
+         * @brief Constructs an object in its slot.
+         * @tparam T Object type, one of Objects.
+         * @param args [in] Constructor arguments.
+         * @return Pointer to the object.
+         */
+        template<typename T, typename ... Args>
+        requires (std::is_same_v<T, Objects> || ...)
+        static T* construct(Args&& ... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+          return ::new (static_cast<void*>(Section::storage() + offset<T>())) T(std::forward<Args>(args)...);
+        }
+        /**
+         * @brief Gets the slot of an object, for operator new overloads.
+         * @tparam T Object type, one of Objects.
+         * @param sz [in] Object size.
+         * @return Pointer to the slot, nullptr if sz is larger than sizeof(T).
+         */
+        template<typename T>
+        requires (std::is_same_v<T, Objects> || ...)
+        static void* allocate(const std::size_t sz = sizeof(T)) noexcept {
+          return sz > sizeof(T) ? nullptr : static_cast<void*>(Section::storage() + offset<T>());
+        }
+
+        static void deallocate([[maybe_unused]]void* ptr) noexcept { }
     };
 }
 
@@ -0,0 +1,479 @@
+/**
+ * @file embedded_async.hpp
+ * @date 2024-10-17
+ * @author Robert Morley
+ *
+ * @brief Embedded Template Library : Coroutine driver operations header file.
+ *
+ * @version v0.1.0
+ * @copyright Copyright (c) 2024
+ */
+#ifndef EMBEDDED_TL_EMBEDDED_ASYNC_HPP
+#define EMBEDDED_TL_EMBEDDED_ASYNC_HPP
+
+#include <array>
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <utility>
+
+#include <embedded_types.hpp>
+#include <embedded_bits.hpp>
+#include <embedded_concepts.hpp>
+#include <embedded_allocator.hpp>
+#include <embedded_driver.hpp>
+#include <embedded_lock.hpp>
+
+namespace embtl::async {
+
+    namespace details {
+        /**
+         * @brief Coroutine frame slot of a frame pool, Tag makes one pool per driver.
+         */
+        template<typename Tag, std::size_t FrameSize>
+        struct alignas(std::max_align_t) frame_slot {
+            std::byte data[FrameSize];
+        };
+
+        /**
+         * @brief Suspended coroutine and the condition that resumes it.
+         */
+        struct waiter final {
+            std::coroutine_handle<> handle;
+            bool (*ready)(void*) noexcept;
+            void* context;
+        };
+
+        /**
+         * @brief Scheduler waiter list, the storage is owned by basic_scheduler<>.
+         */
+        class scheduler_base final {
+          public:
+            constexpr scheduler_base(waiter* const storage, const std::size_t size) noexcept : waiters(storage), capacity(size) { }
+
+            scheduler_base(const scheduler_base&) = delete;
+            scheduler_base& operator=(const scheduler_base&) = delete;
+            /**
+             * @brief Adds a suspended coroutine.
+             * @return STATUS::OK := added; STATUS::BUFFER_OVERFLOW := the waiter list is full.
+             */
+            STATUS wait(const std::coroutine_handle<> handle, bool (* const ready)(void*) noexcept, void* const context) noexcept {
+              if(count >= capacity){
+                return STATUS::BUFFER_OVERFLOW;
+              }
+              waiters[count++] = { handle, ready, context };
+              return STATUS::OK;
+            }
+            /**
+             * @brief Checks every waiter once, the waiters whose condition is met are removed and resumed.
+             * @return Number of coroutines resumed.
+             */
+            std::size_t run_once() noexcept {
+              std::size_t resumed = 0;
+              for(std::size_t i = 0; i < count; ){
+                const auto item = waiters[i];
+                if(item.ready(item.context)){
+                  waiters[i] = waiters[--count];
+                  item.handle.resume();
+                  ++resumed;
+                } else {
+                  ++i;
+                }
+              }
+              return resumed;
+            }
+
+            [[nodiscard]] std::size_t waiting() const noexcept { return count; }
+
+          private:
+            waiter* waiters;
+            std::size_t capacity;
+            std::size_t count = 0;
+        };
+
+        /**
+         * @brief Promise members shared by all task types, the scheduler is passed from a task to the tasks it awaits.
+         */
+        struct promise_base {
+            scheduler_base* scheduler = nullptr;
+            std::coroutine_handle<> continuation { };
+            STATUS status = STATUS::UNINITIALIZED;
+        };
+    }
+
+    /**
+     * @brief Static coroutine frame pool, Frames slots of FrameSize bytes, see basic_pool_allocator<>.
+     * @tparam Tag Pool owner type, one pool per tag (ex: the driver region type).
+     * @tparam FrameSize Largest coroutine frame in bytes. (default = 256)
+     * @tparam Frames Number of frames, the number of tasks alive at the same time. (default = 4)
+     */
+    template<typename Tag, std::size_t FrameSize = 256, std::size_t Frames = 4>
+    using frame_pool = basic_pool_allocator<details::frame_slot<Tag, FrameSize>, Frames>;
+
+    /**
+     * @brief Driver operation coroutine, the frame is allocated from FramePool and the result is a STATUS.
+     * @tparam FramePool Frame allocator, see frame_pool<>.
+     * @details
+     * A task starts suspended. It is started by basic_scheduler<>::spawn() or by co_await from another task, the awaited
+     * task runs on the scheduler of the awaiting task and resumes it when it completes. If the frame pool has no free
+     * slot, or the frame is larger than the slot, the task is empty and has_error() is true; co_await of an empty task
+     * returns STATUS::NOT_AVAILABLE.
+     *
+     * @note The task owns the frame, it must be kept alive until done().
+     */
+    template<mmio_allocator FramePool>
+    class [[nodiscard]] task final {
+      public:
+        struct promise_type;
+        using handle_type = std::coroutine_handle<promise_type>;
+
+        struct final_awaiter final {
+            [[nodiscard]] bool await_ready() const noexcept { return false; }
+            std::coroutine_handle<> await_suspend(const handle_type handle) const noexcept {
+              const auto continuation = handle.promise().continuation;
+              return continuation ? continuation : std::noop_coroutine();
+            }
+            void await_resume() const noexcept { }
+        };
+
+        struct promise_type : public details::promise_base {
+            static void* operator new(const std::size_t sz) noexcept { return FramePool::allocate(sz); }
+            static void operator delete(void* ptr) noexcept { FramePool::deallocate(ptr); }
+            static task get_return_object_on_allocation_failure() noexcept { return task { }; }
+
+            task get_return_object() noexcept { return task { handle_type::from_promise(*this) }; }
+            std::suspend_always initial_suspend() const noexcept { return { }; }
+            final_awaiter final_suspend() const noexcept { return { }; }
+            void return_value(const STATUS value) noexcept { status = value; }
+            void unhandled_exception() noexcept { status = STATUS::ERROR; }
+        };
+
+        struct awaiter final {
+            [[nodiscard]] bool await_ready() const noexcept { return !handle || handle.done(); }
+
+            template<std::derived_from<details::promise_base> Promise>
+            std::coroutine_handle<> await_suspend(const std::coroutine_handle<Promise> parent) const noexcept {
+              handle.promise().scheduler = parent.promise().scheduler;
+              handle.promise().continuation = parent;
+              return handle;
+            }
+
+            [[nodiscard]] STATUS await_resume() const noexcept { return handle ? handle.promise().status : STATUS::NOT_AVAILABLE; }
+
+            handle_type handle;
+        };
+
+        task() noexcept = default;
+        explicit task(const handle_type h) noexcept : handle(h) { }
+
+        task(const task&) = delete;
+        task& operator=(const task&) = delete;
+        task(task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) { }
+        task& operator=(task&& other) noexcept {
+          if(this != &other){
+            destroy();
+            handle = std::exchange(other.handle, nullptr);
+          }
+          return *this;
+        }
+
+        ~task() noexcept { destroy(); }
+
+        [[nodiscard]] auto has_error() const noexcept -> bool { return !handle; }
+        [[nodiscard]] auto done() const noexcept -> bool { return handle && handle.done(); }
+        /**
+         * @brief Task result.
+         * @return co_return value if done(); STATUS::BUSY := running or not started; STATUS::NOT_AVAILABLE := empty task.
+         */
+        [[nodiscard]] auto status() const noexcept -> STATUS {
+          if(!handle){
+            return STATUS::NOT_AVAILABLE;
+          }
+          return handle.done() ? handle.promise().status : STATUS::BUSY;
+        }
+
+        awaiter operator co_await() const noexcept { return { handle }; }
+
+        /**
+         * @brief Starts the task on a scheduler, runs it until its first suspension.
+         * @return STATUS::OK := started; STATUS::INVALID_PARAMETER := empty or already started task.
+         */
+        STATUS start(details::scheduler_base& scheduler) noexcept {
+          if(!handle || handle.promise().scheduler != nullptr){
+            return STATUS::INVALID_PARAMETER;
+          }
+          handle.promise().scheduler = &scheduler;
+          handle.resume();
+          return STATUS::OK;
+        }
+
+      private:
+        void destroy() noexcept {
+          if(handle){
+            handle.destroy();
+            handle = nullptr;
+          }
+        }
+
+        handle_type handle { };
+    };
+
+    /**
+     * @brief Awaits a condition, the coroutine is parked in the scheduler until ready() returns true.
+     * @tparam Ready Condition, bool() noexcept.
+     * @details
+     * The condition is checked once when awaited, if it is already true the coroutine is not suspended. co_await
+     * returns STATUS::OK when the condition is met, STATUS::BUFFER_OVERFLOW if the scheduler waiter list is full and
+     * STATUS::NOT_AVAILABLE if the task has no scheduler; in both error cases the coroutine is not suspended.
+     */
+    template<typename Ready>
+    class condition_awaiter final {
+      public:
+        explicit condition_awaiter(Ready r) noexcept : ready(std::move(r)) { }
+
+        [[nodiscard]] bool await_ready() noexcept { return ready(); }
+
+        template<std::derived_from<details::promise_base> Promise>
+        bool await_suspend(const std::coroutine_handle<Promise> handle) noexcept {
+          auto* const scheduler = handle.promise().scheduler;
+          status = scheduler == nullptr ? STATUS::NOT_AVAILABLE : scheduler->wait(handle, &check, this);
+          return status == STATUS::OK;
+        }
+
+        [[nodiscard]] STATUS await_resume() const noexcept { return status; }
+
+      private:
+        static bool check(void* self) noexcept { return static_cast<condition_awaiter*>(self)->ready(); }
+
+        Ready ready;
+        STATUS status = STATUS::OK;
+    };
+
+    /**
+     * @brief Awaits a register bit field value.
+     * @tparam Field Bit field descriptor, see embtl::field<>.
+     * @param reg [in] Register, basic_hardware_register<> with read access.
+     * @param value [in] Field value, not shifted.
+     * @return Awaitable, co_await returns a STATUS, see condition_awaiter<>.
+     * @note The register is read when awaited and on each scheduler pass, after an interrupt.
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  co_await embtl::async::reg_condition<SPI_SR_TXE>(reg_map->SR, 1);
+     *
+     * @endcode
+     */
+    template<register_bit_field Field, mmio_hardware_register Reg>
+    auto reg_condition(Reg& reg, const field_value_t<Field, typename Reg::value_type> value) noexcept {
+      using value_type = typename Reg::value_type;
+      static_assert(Reg::has_read_access(), "Register does not have read access.");
+      static_assert(fields_fit<value_type, Field>(), "Field is outside of the register value type.");
+      return condition_awaiter { [&reg, value]() noexcept { return extract_field<value_type, Field>(reg.read()) == value; } };
+    }
+
+    /**
+     * @brief Interrupt event, signal() from the interrupt handler resumes the coroutine awaiting the event.
+     * @details
+     * signal() is one atomic store and can be called from interrupt handlers. The awaiting coroutine is resumed by
+     * the next scheduler pass, never from the interrupt handler. A signal is consumed by one co_await, a signal sent
+     * before co_await is not lost.
+     */
+    class event final {
+      public:
+        event() noexcept = default;
+
+        event(const event&) = delete;
+        event& operator=(const event&) = delete;
+
+        void signal() noexcept { pending.store(true, std::memory_order_release); }
+
+        [[nodiscard]] bool is_set() const noexcept { return pending.load(std::memory_order_acquire); }
+
+        auto operator co_await() noexcept {
+          return condition_awaiter { [this]() noexcept { return pending.exchange(false, std::memory_order_acquire); } };
+        }
+
+      private:
+        std::atomic<bool> pending { false };
+    };
+
+    namespace idle {
+        /**
+         * @brief Idle policy : wait for interrupt (WFI), the core sleeps until the next interrupt.
+         * @details
+         * Interrupts are masked (PRIMASK) while the waiters are checked again and WFI is executed, an interrupt that
+         * fired after the last scheduler pass is seen by recheck() and one that fires later still wakes the core from
+         * WFI, it is handled once PRIMASK is restored. Tasks resumed by recheck() run with interrupts masked.
+         * @note On the host build WFI is not executed, the scheduler polls the waiters.
+         */
+        struct wfi final {
+          public:
+            static bool idle(bool (* const recheck)(void*) noexcept, void* const context) noexcept {
+#if defined(__ARM_ARCH) && !defined(UNIT_TEST)
+              const auto state = lock::primask_lock::lock();
+              if(!recheck(context)){
+                asm volatile ("wfi" ::: "memory");
+              }
+              lock::primask_lock::unlock(state);
+#else
+              static_cast<void>(recheck(context));
+#endif
+              return true;
+            }
+        };
+        static_assert(async_idle_policy<wfi>);
+
+        /**
+         * @brief Idle policy : host stand-in, each idle() fires the oldest simulated interrupt.
+         * @tparam N Maximum number of pending simulated interrupts.
+         * @details
+         * raise() queues an interrupt handler, idle() calls it as if the interrupt had fired while the core was
+         * sleeping. Like idle::wfi, idle() first calls recheck() and does not sleep if it resumed a task. idle() returns
+         * false when no interrupt is pending, the scheduler run() then returns.
+         */
+        template<std::size_t N = 16>
+        requires (N > 0)
+        struct basic_host_interrupts final {
+          public:
+            using handler_type = void (*)(void*) noexcept;
+            /**
+             * @brief Queues a simulated interrupt.
+             * @param handler [in] Interrupt handler.
+             * @param context [in] Handler argument.
+             * @return STATUS::OK := queued; STATUS::BUFFER_OVERFLOW := queue full.
+             */
+            static STATUS raise(const handler_type handler, void* const context = nullptr) noexcept {
+              if(count == N){
+                return STATUS::BUFFER_OVERFLOW;
+              }
+              queue[(first + count++) % N] = { handler, context };
+              return STATUS::OK;
+            }
+
+            static bool idle(bool (* const recheck)(void*) noexcept, void* const context) noexcept {
+              if(recheck(context)){
+                return true;
+              }
+              if(count == 0){
+                return false;
+              }
+              const auto irq = queue[first];
+              first = (first + 1) % N;
+              --count;
+              irq.handler(irq.context);
+              return true;
+            }
+
+            static std::size_t pending() noexcept { return count; }
+
+          private:
+            struct interrupt {
+                handler_type handler;
+                void* context;
+            };
+
+            static inline std::array<interrupt, N> queue { };
+            static inline std::size_t first = 0;
+            static inline std::size_t count = 0;
+        };
+
+        using host_interrupts = basic_host_interrupts<>;
+        static_assert(async_idle_policy<host_interrupts>);
+    }
+
+    /**
+     * @brief Cooperative scheduler of driver tasks, resumes the tasks whose awaited condition is met.
+     * @tparam MaxWaiters Maximum number of suspended tasks.
+     * @tparam Idle Idle policy, called when a pass resumed no task. (default = idle::wfi)
+     * @details
+     * The scheduler has no thread and no heap: run_once() checks each suspended task once, run() repeats the passes
+     * and calls Idle::idle() between passes that made no progress, until no task is suspended or idle() returns false.
+     * idle() runs one more pass with interrupts masked before sleeping, a condition met by an interrupt between a pass
+     * and idle() does not leave the core sleeping.
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  embtl::async::basic_scheduler<4> scheduler;
+     *
+     *  auto tx = spi1.transfer(tx_buffer);    // spi_driver::task
+     *  auto adc = adc1.convert(samples);      // adc_driver::task
+     *  scheduler.spawn(tx);
+     *  scheduler.spawn(adc);
+     *  scheduler.run();                       // sleeps with WFI while both peripherals are busy.
+     *
+     * @endcode
+     */
+    template<std::size_t MaxWaiters, async_idle_policy Idle = idle::wfi>
+    requires (MaxWaiters > 0)
+    class basic_scheduler final {
+      public:
+        basic_scheduler() noexcept = default;
+
+        basic_scheduler(const basic_scheduler&) = delete;
+        basic_scheduler& operator=(const basic_scheduler&) = delete;
+        /**
+         * @brief Starts a task, runs it until its first suspension.
+         * @param t [in] Task.
+         * @return STATUS::OK := started; STATUS::INVALID_PARAMETER := empty or already started task.
+         */
+        template<typename FramePool>
+        STATUS spawn(task<FramePool>& t) noexcept { return t.start(waiters); }
+
+        std::size_t run_once() noexcept { return waiters.run_once(); }
+        /**
+         * @brief Runs until no task is suspended or the idle policy returns false.
+         * @return Number of tasks still suspended.
+         */
+        std::size_t run() noexcept {
+          while(waiters.waiting() > 0){
+            if(waiters.run_once() == 0 && !Idle::idle(&recheck, &waiters)){
+              break;
+            }
+          }
+          return waiters.waiting();
+        }
+
+        [[nodiscard]] std::size_t waiting() const noexcept { return waiters.waiting(); }
+
+      private:
+        static bool recheck(void* const context) noexcept { return static_cast<details::scheduler_base*>(context)->run_once() > 0; }
+
+        std::array<details::waiter, MaxWaiters> storage { };
+        details::scheduler_base waiters { storage.data(), MaxWaiters };
+    };
+}
+
+namespace embtl {
+
+    /**
+     * @brief Device driver base class with coroutine operations, the coroutine frames come from a static pool.
+     * @tparam DeviceIoRegion Device region type.
+     * @tparam FrameSize Largest coroutine frame in bytes. (default = 256)
+     * @tparam Frames Number of driver operations in flight. (default = 4)
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  struct spi_driver : public embtl::basic_async_driver<spi_region_t> {
+     *    task transfer(const std::uint8_t byte) {
+     *      co_await embtl::async::reg_condition<SPI_SR_TXE>(reg_map->SR, 1);
+     *      reg_map->DR.write(byte);
+     *      co_return co_await rx_done;         // signaled by the SPI interrupt handler.
+     *    }
+     *
+     *    embtl::async::event rx_done;
+     *  };
+     *
+     * @endcode
+     */
+    template<typename DeviceIoRegion, std::size_t FrameSize = 256, std::size_t Frames = 4>
+    struct basic_async_driver : public basic_driver<DeviceIoRegion> {
+      public:
+        using frame_pool_type = async::frame_pool<DeviceIoRegion, FrameSize, Frames>;
+        using task = async::task<frame_pool_type>;
+    };
+}
+
+#endif //EMBEDDED_TL_EMBEDDED_ASYNC_HPP
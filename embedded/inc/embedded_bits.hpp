@@ -111,6 +111,158 @@ namespace embtl {
 
     template<mask_parameters ... PosSize>
     constexpr auto mask_8b = static_mask<std::int8_t, PosSize ...>;
+
+    /**
+     * @brief Bit field value assignment, created by the field<>::operator= method.
+     * @tparam Field Bit field descriptor.
+     * @tparam T Value type assigned to the field.
+     */
+    template<typename Field, typename T>
+    struct field_assignment final {
+      public:
+        using field_type = Field;
+        using value_type = T;
+
+        value_type value;   /**< Field value, not shifted. */
+    };
+
+    /**
+     * @brief Compile time register bit field descriptor.
+     * @tparam Pos Starting bit position of the field.
+     * @tparam Size Size of the field in bits. (default = 1)
+     * @tparam ValueType Field value type, unsigned integral or enumeration type. (default = void := register value type)
+     *
+     * @details
+     * The position and size of the field are template constants, the masks and shifts used by the
+     * basic_hardware_register<>::get<>(), set<>() and clear<>() methods are generated at compile time.
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  enum class uart_parity : embtl::arch_type { NONE = 0, EVEN = 2, ODD = 3 };
+     *
+     *  using UART_CTRL_EN = embtl::field<0>;
+     *  using UART_CTRL_PARITY = embtl::field<4, 2, uart_parity>;
+     *
+     *  uart->CTRL.set<UART_CTRL_PARITY>(uart_parity::EVEN);
+     *  auto enabled = uart->CTRL.get<UART_CTRL_EN>();
+     *
+     *  // Multiple fields in a single read-modify-write.
+     *  uart->CTRL.modify(UART_CTRL_EN{} = 1, UART_CTRL_PARITY{} = uart_parity::ODD);
+     *
+     * @endcode
+     */
+    template<std::size_t Pos, std::size_t Size = 1, typename ValueType = void>
+    requires ((Size > 0) && (std::is_void_v<ValueType> || std::is_enum_v<ValueType> || embedded_base_type<ValueType>))
+    struct field final {
+      public:
+        using value_type = ValueType;
+
+        static constexpr std::size_t position = Pos;
+        static constexpr std::size_t size = Size;
+        /**
+         * @brief Checks if the field is within the bits of type T.
+         * @tparam T Register value type.
+         * @return true := field fits in type T; false := field is outside of type T.
+         */
+        template<embedded_base_type T>
+        static consteval bool fits() noexcept { return (Pos + Size) <= std::numeric_limits<T>::digits; }
+        /**
+         * @brief Field mask for type T.
+         * @tparam T Register value type.
+         * @return Field mask shifted to the field position.
+         */
+        template<embedded_base_type T>
+        static consteval T mask() noexcept { return make_mask<T>(Pos, Size); }
+        /**
+         * @brief Field value assignment, used by the basic_hardware_register<>::modify() and write_fields() methods.
+         * @param value [in] Field value, not shifted.
+         * @return Field assignment object.
+         * @note Value must be convertible to the field value type, or an integral type if field value type is void.
+         */
+        template<typename T>
+        requires (std::is_void_v<value_type> ? std::is_integral_v<T> : std::is_convertible_v<T, value_type>)
+        constexpr auto operator=(const T value) const noexcept -> field_assignment<field, T> {
+          return { value };
+        }
+    };
+
+    /**
+     * @brief Value type of a bit field for register value type Base.
+     * @tparam Field Bit field descriptor.
+     * @tparam Base Register value type, used if the field value type is void.
+     */
+    template<register_bit_field Field, embedded_base_type Base>
+    using field_value_t = std::conditional_t<std::is_void_v<typename Field::value_type>, Base, typename Field::value_type>;
+
+    /**
+     * @brief Checks if all bit fields are within the bits of type T.
+     * @tparam T Register value type.
+     * @tparam Fields Bit field descriptors.
+     */
+    template<embedded_base_type T, register_bit_field ... Fields>
+    consteval bool fields_fit() noexcept {
+      return (((Fields::position + Fields::size) <= std::numeric_limits<T>::digits) && ...);
+    }
+    /**
+     * @brief Combined mask of bit fields for type T.
+     * @tparam T Register value type.
+     * @tparam Fields Bit field descriptors.
+     */
+    template<embedded_base_type T, register_bit_field ... Fields>
+    consteval T fields_mask() noexcept {
+      return static_cast<T>((make_mask<T>(Fields::position, Fields::size) | ... | T{ 0 }));
+    }
+    /**
+     * @brief Checks that no two bit fields share a bit.
+     * @tparam T Register value type.
+     * @tparam Fields Bit field descriptors.
+     */
+    template<embedded_base_type T, register_bit_field ... Fields>
+    consteval bool fields_disjoint() noexcept {
+      T combined { 0 };
+      for(const T field_mask : { make_mask<T>(Fields::position, Fields::size) ... }){
+        if((combined & field_mask) != 0){
+          return false;
+        }
+        combined |= field_mask;
+      }
+      return true;
+    }
+    /**
+     * @brief Extracts a bit field value from a register value.
+     * @tparam T Register value type.
+     * @tparam Field Bit field descriptor.
+     * @param value [in] Register value.
+     * @return Field value shifted to bit position 0.
+     */
+    template<embedded_base_type T, register_bit_field Field>
+    constexpr auto extract_field(const T value) noexcept -> field_value_t<Field, T> {
+      constexpr auto field_mask = fields_mask<T, Field>();
+      return static_cast<field_value_t<Field, T>>((value & field_mask) >> Field::position);
+    }
+    /**
+     * @brief Inserts a bit field value into its register bit position.
+     * @tparam T Register value type.
+     * @tparam Field Bit field descriptor.
+     * @param value [in] Field value, not shifted.
+     * @return Field value masked and shifted to the field position.
+     */
+    template<embedded_base_type T, register_bit_field Field>
+    constexpr auto insert_field(const field_value_t<Field, T> value) noexcept -> T {
+      constexpr auto field_mask = fields_mask<T, Field>();
+      return static_cast<T>(static_cast<T>(value) << Field::position) & field_mask;
+    }
+    /**
+     * @brief Combines field assignments into a register value.
+     * @tparam T Register value type.
+     * @param values [in] Field assignments.
+     * @return Register value with only the field bits set.
+     */
+    template<embedded_base_type T, register_bit_field ... Fields, typename ... Ts>
+    constexpr auto insert_fields(const field_assignment<Fields, Ts> ... values) noexcept -> T {
+      return static_cast<T>((insert_field<T, Fields>(static_cast<field_value_t<Fields, T>>(values.value)) | ... | T{ 0 }));
+    }
 }
 
 #endif //EMBEDDED_TL_EMBEDDED_BITMANIP_HPP
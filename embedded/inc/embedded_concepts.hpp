@@ -11,6 +11,8 @@
 #ifndef EMBEDDED_TL_EMBEDDED_CONCEPTS_HPP
 #define EMBEDDED_TL_EMBEDDED_CONCEPTS_HPP
 
+#include <cstddef>
+
 #include <embedded_types.hpp>
 
 namespace embtl {
@@ -20,38 +22,172 @@ namespace embtl {
                                  std::is_unsigned_v<T> &&
                                  !std::is_same_v<T, bool>;
 
+    /**
+     * @brief Compile time register bit field descriptor concept.
+     * @tparam T Type to be checked.
+     */
     template<typename T>
-    concept mmio_register_policy_read_only = requires (
-            volatile arch_type& reg, std::size_t pos, std::size_t sz, bool shifted) {
-      { T::read(reg) } -> std::same_as<arch_type>;
-      { T::get_field(reg, pos, sz, shifted) } -> std::same_as<arch_type>;
+    concept register_bit_field = requires {
+      typename T::value_type;
+      { T::position } -> std::convertible_to<std::size_t>;
+      { T::size } -> std::convertible_to<std::size_t>;
     };
 
+    namespace details {
+        template<typename T>
+        struct policy_value_type {
+            using type = arch_type;
+        };
+
+        template<typename T>
+        requires requires { typename T::value_type; }
+        struct policy_value_type<T> {
+            using type = typename T::value_type;
+        };
+    }
+
+    /**
+     * @brief Register value type of a policy, the policy value_type or arch_type if the policy has no value_type.
+     * @tparam T Register policy type.
+     */
     template<typename T>
-    concept mmio_register_policy_write_only = requires (volatile arch_type& reg, const arch_type value) {
+    using policy_value_t = typename details::policy_value_type<T>::type;
+
+    /**
+     * @brief Read-only register policy for registers of type Base.
+     * @tparam T Type to be checked.
+     * @tparam Base Register value type. (default = policy value type)
+     */
+    template<typename T, typename Base = policy_value_t<T>>
+    concept mmio_register_policy_read_only = requires (
+            volatile Base& reg, std::size_t pos, std::size_t sz, bool shifted) {
+      { T::read(reg) } -> std::same_as<Base>;
+      { T::get_field(reg, pos, sz, shifted) } -> std::same_as<Base>;
+    };
+
+    template<typename T, typename Base = policy_value_t<T>>
+    concept mmio_register_policy_write_only = requires (volatile Base& reg, const Base value) {
       { T::write(reg, value) } -> std::same_as<void>;
     };
 
-    template<typename T>
-    concept mmio_register_policy_read_write = mmio_register_policy_read_only<T> && mmio_register_policy_write_only<T> &&
-            requires (volatile arch_type& reg, std::size_t pos, std::size_t sz, arch_type value, bool masked) {
+    template<typename T, typename Base = policy_value_t<T>>
+    concept mmio_register_policy_read_write = mmio_register_policy_read_only<T, Base> && mmio_register_policy_write_only<T, Base> &&
+            requires (volatile Base& reg, std::size_t pos, std::size_t sz, Base value, bool masked) {
               { T::set_field(reg, pos, sz, value, masked) } -> std::same_as<void>;
               { T::clear_field(reg, pos, sz) } -> std::same_as<void>;
             };
 
+    /**
+     * @brief Read/Write register policy with atomic bit set, clear and toggle methods (ex: SET/CLR/XOR alias registers).
+     * @tparam T Type to be checked.
+     * @tparam Base Register value type. (default = policy value type)
+     */
+    template<typename T, typename Base = policy_value_t<T>>
+    concept mmio_register_policy_atomic_bits = mmio_register_policy_read_write<T, Base> &&
+            requires (volatile Base& reg, const Base bits) {
+              { T::set_bits(reg, bits) } -> std::same_as<void>;
+              { T::clear_bits(reg, bits) } -> std::same_as<void>;
+              { T::toggle_bits(reg, bits) } -> std::same_as<void>;
+            };
+
+    /**
+     * @brief Read/Write register policy with an atomic read-modify-write method (ex: compare-exchange loop).
+     * @tparam T Type to be checked.
+     * @tparam Base Register value type. (default = policy value type)
+     */
+    template<typename T, typename Base = policy_value_t<T>>
+    concept mmio_register_policy_atomic_modify = mmio_register_policy_atomic_bits<T, Base> &&
+            requires (volatile Base& reg, const Base clear_mask, const Base set_value) {
+              { T::modify(reg, clear_mask, set_value) } -> std::same_as<void>;
+            };
+
+    /**
+     * @brief Write-one-to-clear (W1C) register policy, bits are cleared with a single store and never read back.
+     * @tparam T Type to be checked.
+     * @tparam Base Register value type. (default = policy value type)
+     */
+    template<typename T, typename Base = policy_value_t<T>>
+    concept mmio_register_policy_write_1_clear = mmio_register_policy_read_only<T, Base> && mmio_register_policy_write_only<T, Base> &&
+            !mmio_register_policy_read_write<T, Base> &&
+            requires (volatile Base& reg, std::size_t pos, std::size_t sz, const Base bits) {
+              { T::clear_bits(reg, bits) } -> std::same_as<void>;
+              { T::clear_field(reg, pos, sz) } -> std::same_as<void>;
+            };
+
+    /**
+     * @brief Read-to-clear (R2C) register policy, the register is cleared by a read.
+     * @tparam T Type to be checked.
+     * @tparam Base Register value type. (default = policy value type)
+     */
+    template<typename T, typename Base = policy_value_t<T>>
+    concept mmio_register_policy_read_clear = mmio_register_policy_read_only<T, Base> && !mmio_register_policy_write_only<T, Base> &&
+            requires (volatile Base& reg) {
+              { T::clear(reg) } -> std::same_as<void>;
+            };
+
+    /**
+     * @brief Register read-modify-write lock policy, lock() returns the state restored by unlock().
+     * @tparam T Type to be checked.
+     */
     template<typename T>
-    concept mmio_side_effect_read_only = requires (volatile arch_type& reg) {
-      { T::read(reg) } -> std::same_as<void>;
+    concept register_lock_policy = requires {
+      typename T::state_type;
+      { T::lock() } -> std::same_as<typename T::state_type>;
+    } && requires (const typename T::state_type state) {
+      { T::unlock(state) } -> std::same_as<void>;
     };
 
+    /**
+     * @brief Register polling backoff policy, backoff() is called between two register reads.
+     * @tparam T Type to be checked.
+     */
     template<typename T>
-    concept mmio_side_effect_write_only = requires (volatile arch_type& reg, const arch_type& lvalue, arch_type&& rvalue) {
+    concept wait_backoff_policy = requires (const std::size_t iteration) {
+      { T::backoff(iteration) } -> std::same_as<void>;
+    };
+
+    /**
+     * @brief Register polling counter hook, now() is a free running cycle counter, record() reports a finished wait.
+     * @tparam T Type to be checked.
+     */
+    template<typename T>
+    concept wait_counter_policy = requires (const std::size_t iterations, const std::uint32_t cycles) {
+      { T::now() } -> std::same_as<std::uint32_t>;
+      { T::record(iterations, cycles) } -> std::same_as<void>;
+    };
+
+    /**
+     * @brief Scheduler idle policy, idle() waits for the next interrupt, false if no interrupt can happen.
+     * @tparam T Type to be checked.
+     */
+    template<typename T>
+    concept async_idle_policy = requires (bool (* const recheck)(void*) noexcept, void* const context) {
+      { T::idle(recheck, context) } -> std::same_as<bool>;
+    };
+
+    template<typename T, typename Base = arch_type>
+    concept mmio_side_effect_read_only = requires (volatile Base& reg) {
+      { T::read(reg) } -> std::same_as<void>;
+    };
+
+    template<typename T, typename Base = arch_type>
+    concept mmio_side_effect_write_only = requires (volatile Base& reg, const Base& lvalue, Base&& rvalue) {
       { T::write(reg, lvalue) } -> std::same_as<void>;
       { T::write(reg, rvalue) } -> std::same_as<void>;
     };
 
+    template<typename T, typename Base = arch_type>
+    concept mmio_side_effect_read_write = mmio_side_effect_read_only<T, Base> && mmio_side_effect_write_only<T, Base>;
+
+    /**
+     * @brief Hardware register concept, ex: basic_hardware_register<>.
+     * @tparam T Type to be checked.
+     */
     template<typename T>
-    concept mmio_side_effect_read_write = mmio_side_effect_read_only<T> && mmio_side_effect_write_only<T>;
+    concept mmio_hardware_register = requires {
+      typename T::value_type;
+      typename T::access_policy;
+    } && embedded_base_type<typename T::value_type>;
 
     /**
      * @brief Memory Mapped IO (MMIO) Single Device concept.
@@ -80,6 +216,27 @@ namespace embtl {
     template<typename T>
     concept mmio_multi_allocator_alpha_numeric = mmio_multi_allocator_alpha<T> || mmio_multi_allocator_numeric<T>;
 
+    /**
+     * @brief Memory section concept, ex: a type defined with EMBEDDED_MEMORY_SECTION.
+     * @tparam T Type to be checked.
+     */
+    template<typename T>
+    concept memory_section = requires {
+      typename T::objects;
+      { T::name } -> std::convertible_to<const char*>;
+      { T::capacity } -> std::convertible_to<std::size_t>;
+      { T::alignment } -> std::convertible_to<std::size_t>;
+      { T::storage() } -> std::same_as<std::byte*>;
+    };
+
+    /**
+     * @brief DMA element type concept, a trivially copyable type of 1, 2, 4 or 8 bytes (the DMA transfer width).
+     * @tparam T Type to be checked.
+     */
+    template<typename T>
+    concept dma_element_type = std::is_trivially_copyable_v<T> &&
+                               (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
     template<typename T>
     concept io_pin_input = requires (T a, IO_STATE state) {
       { a.read() } -> std::same_as<IO_STATE>;
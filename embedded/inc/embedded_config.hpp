@@ -0,0 +1,258 @@
+/**
+ * @file embedded_config.hpp
+ * @date 2024-10-16
+ * @author Robert Morley
+ *
+ * @brief Embedded Template Library : Diff-based register configuration header file.
+ *
+ * @version v0.1.0
+ * @copyright Copyright (c) 2024
+ */
+#ifndef EMBEDDED_TL_EMBEDDED_CONFIG_HPP
+#define EMBEDDED_TL_EMBEDDED_CONFIG_HPP
+
+#include <cstddef>
+
+#include <embedded_types.hpp>
+#include <embedded_bits.hpp>
+#include <embedded_concepts.hpp>
+#include <embedded_register.hpp>
+#include <embedded_region.hpp>
+#include <embedded_transaction.hpp>
+
+namespace embtl {
+
+    /**
+     * @brief Desired value of the bits in mask of one register.
+     * @tparam Member Register member pointer, ex: &uart_register_map::CTRL.
+     * @note Created with embtl::config<Member>().
+     */
+    template<auto Member>
+    requires (std::is_member_object_pointer_v<decltype(Member)> && mmio_hardware_register<register_member_t<Member>>)
+    struct register_config final {
+      public:
+        using register_type = register_member_t<Member>;
+        using value_type = typename register_type::value_type;
+
+        static constexpr auto member = Member;
+
+        value_type mask;
+        value_type value;
+    };
+
+    namespace details {
+        template<typename T>
+        struct is_register_config : std::false_type { };
+
+        template<auto Member>
+        struct is_register_config<register_config<Member>> : std::true_type { };
+    }
+
+    /**
+     * @brief Checks if T is a register_config<>.
+     * @tparam T Type to be checked.
+     */
+    template<typename T>
+    concept register_config_entry = details::is_register_config<std::remove_cvref_t<T>>::value;
+
+    /**
+     * @brief Creates a register configuration of the whole register, all bits of the register WriteMask().
+     * @tparam Member Register member pointer, ex: &uart_register_map::BAUD.
+     * @param value [in] Register value.
+     * @return Register configuration.
+     */
+    template<auto Member>
+    constexpr auto config(const typename register_member_t<Member>::value_type value) noexcept -> register_config<Member> {
+      using reg_type = register_member_t<Member>;
+      static_assert(reg_type::has_write_access(), "Register does not have write access.");
+      return { reg_type::WriteMask(), static_cast<typename reg_type::value_type>(value & reg_type::WriteMask()) };
+    }
+    /**
+     * @brief Creates a register configuration of bit fields, the other register bits are not changed.
+     * @tparam Member Register member pointer, ex: &uart_register_map::CTRL.
+     * @param values [in] Field assignments, ex: config<&map::CTRL>(FIELD_A{} = 1, FIELD_B{} = 2).
+     * @return Register configuration.
+     */
+    template<auto Member, register_bit_field ... Fields, typename ... Ts>
+    requires (sizeof...(Fields) > 0)
+    constexpr auto config(const field_assignment<Fields, Ts> ... values) noexcept -> register_config<Member> {
+      using reg_type = register_member_t<Member>;
+      using value_type = typename reg_type::value_type;
+      static_assert(reg_type::has_write_access(), "Register does not have write access.");
+      static_assert(fields_fit<value_type, Fields...>(), "Field is outside of the register value type.");
+      static_assert((fields_mask<value_type, Fields...>() & ~reg_type::WriteMask()) == 0, "Field overlaps bits outside of the register write mask.");
+      static_assert(fields_disjoint<value_type, Fields...>(), "Fields overlap each other.");
+      return { fields_mask<value_type, Fields...>(), insert_fields<value_type>(values...) };
+    }
+
+    namespace config_order {
+        /**
+         * @brief Write order policy : registers are written in the order the configurations are given.
+         */
+        struct listed final { };
+        /**
+         * @brief Write order policy : registers are written in register map declaration order.
+         */
+        struct declaration final { };
+    }
+
+    namespace details {
+        /**
+         * @brief Shadow type used when the configuration is compared against the register values.
+         */
+        struct no_shadow final { };
+
+        template<auto Member, typename Registers, typename Value>
+        void write_config(Registers& registers, const Value value) noexcept {
+          (registers.*Member).write(value);
+        }
+
+        template<auto Member, typename RegisterMap, typename Value>
+        void write_config(register_transaction<RegisterMap>& tx, const Value value) noexcept {
+          tx.template write<Member>(value);
+        }
+        /**
+         * @brief Gets the value staged by an earlier configuration of the same register.
+         * @return true := value is the staged value; false := nothing staged, registers are written directly.
+         */
+        template<auto Member, typename Registers, typename Value>
+        bool staged_config([[maybe_unused]] const Registers& registers, [[maybe_unused]] Value& value) noexcept {
+          return false;
+        }
+
+        template<auto Member, typename RegisterMap, typename Value>
+        bool staged_config(const register_transaction<RegisterMap>& tx, Value& value) noexcept {
+          if(!tx.template is_pending<Member>()){
+            return false;
+          }
+          value = tx.template get<Member>();
+          return true;
+        }
+        /**
+         * @brief Applies one register configuration.
+         * @param registers [in] Register map.
+         * @param shadow [in] Register shadow values or no_shadow.
+         * @param writer [in] Register map or register transaction, receives the register write.
+         * @param entry [in] Register configuration.
+         * @return 1 := register written; 0 := register unchanged.
+         * @details
+         * The current value is the shadow value, the value staged in the transaction by an earlier configuration of
+         * the same register, or the register value for readable registers. The register is written if the current
+         * value is unknown (write-only register without shadow) or if the desired value is different from the current
+         * value. A write-one-to-clear register is never read: the bits set in the configuration are the flags to clear,
+         * written as 1 in a value starting at 0 (or at the bits staged by an earlier configuration of the register).
+         */
+        template<typename Registers, typename Shadow, typename Writer, auto Member>
+        std::size_t apply_config_entry(Registers& registers, Shadow& shadow, Writer& writer, const register_config<Member>& entry) noexcept {
+          using reg_type = register_member_t<Member>;
+          using value_type = typename reg_type::value_type;
+
+          value_type current;
+          bool known = true;
+
+          if constexpr (reg_type::has_write_1_clear_access()){
+            if(!staged_config<Member>(writer, current)){
+              current = 0;
+            }
+            const auto bits = static_cast<value_type>(current | (entry.value & entry.mask));
+            if(bits == current){
+              return 0;
+            }
+            write_config<Member>(writer, bits);
+            return 1;
+          } else if constexpr (!std::is_same_v<Shadow, no_shadow>){
+            current = shadow.template get<Member>();
+          } else if(!staged_config<Member>(writer, current)){
+            if constexpr (reg_type::has_read_access()){
+              current = (registers.*Member).read();
+            } else {
+              current = reg_type::ResetValue();
+              known = false;
+            }
+          }
+
+          const auto desired = static_cast<value_type>((current & ~entry.mask) | (entry.value & entry.mask));
+
+          if(known && desired == current){
+            return 0;
+          }
+          write_config<Member>(writer, desired);
+          if constexpr (!std::is_same_v<Shadow, no_shadow>){
+            shadow.template set<Member>(desired);
+          }
+          return 1;
+        }
+
+        template<typename Order, typename Registers, typename Shadow, typename ... Configs>
+        std::size_t apply_configs(Registers& registers, Shadow& shadow, const Configs& ... configs) noexcept {
+          std::size_t count = 0;
+
+          if constexpr (std::is_same_v<Order, config_order::declaration>){
+            register_transaction tx { registers };
+            (apply_config_entry(registers, shadow, tx, configs), ...);
+            count = tx.pending();
+            tx.commit();
+          } else {
+            ((count += apply_config_entry(registers, shadow, registers, configs)), ...);
+          }
+          return count;
+        }
+    }
+
+    /**
+     * @brief Writes only the registers whose configuration differs from the current register value.
+     * @tparam Order Write order policy, see embtl::config_order. (default = config_order::listed)
+     * @param registers [in] Register map, basic_device_region<> or basic_mmio_device_registers<>.
+     * @param configs [in] Register configurations, see embtl::config<>().
+     * @return Number of registers written.
+     * @note Readable registers are read once, write-only registers are always written.
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  constexpr auto pwm_config = std::tuple {
+     *      embtl::config<&timer_register_map::PSC>(71),
+     *      embtl::config<&timer_register_map::ARR>(999),
+     *      embtl::config<&timer_register_map::CR1>(TIM_CR1_ARPE{} = 1, TIM_CR1_CEN{} = 1)
+     *  };
+     *
+     *  std::apply([&](const auto& ... configs){ embtl::apply_config(*timer, configs...); }, pwm_config);
+     *
+     * @endcode
+     */
+    template<typename Order = config_order::listed, typename Registers, register_config_entry ... Configs>
+    requires (sizeof...(Configs) > 0)
+    std::size_t apply_config(Registers& registers, const Configs& ... configs) noexcept {
+      details::no_shadow shadow;
+      return details::apply_configs<Order>(registers, shadow, configs...);
+    }
+    /**
+     * @brief Writes only the registers whose configuration differs from the shadow value, the shadow is updated.
+     * @tparam Order Write order policy, see embtl::config_order. (default = config_order::listed)
+     * @param registers [in] Register map, basic_device_region<> or basic_mmio_device_registers<>.
+     * @param shadow [in,out] Last values written to the registers.
+     * @param configs [in] Register configurations, see embtl::config<>().
+     * @return Number of registers written.
+     * @note No register is read. The shadow must hold the register values, ex: from snapshot() or from the previous
+     *       apply_config() calls.
+     */
+    template<typename Order = config_order::listed, typename Registers, typename RegisterMap, register_config_entry ... Configs>
+    requires (sizeof...(Configs) > 0)
+    std::size_t apply_config(Registers& registers, register_snapshot<RegisterMap>& shadow, const Configs& ... configs) noexcept {
+      return details::apply_configs<Order>(registers, shadow, configs...);
+    }
+    /**
+     * @brief Writes only the read/write registers whose value differs from a register map image, in declaration order.
+     * @param registers [in] Register map, basic_device_region<> or basic_mmio_device_registers<>.
+     * @param desired [in] Register map image.
+     * @return Number of registers written.
+     * @note Only the register bits in WriteMask() are compared. The image is runtime only, register_snapshot<> is not
+     *       a constant expression type; use config<>() entries for a configuration known at compile time.
+     */
+    template<typename Registers, typename RegisterMap>
+    std::size_t apply_config(Registers& registers, const register_snapshot<RegisterMap>& desired) noexcept {
+      return desired.apply(registers);
+    }
+}
+
+#endif //EMBEDDED_TL_EMBEDDED_CONFIG_HPP
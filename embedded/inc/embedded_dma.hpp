@@ -0,0 +1,585 @@
+/**
+ * @file embedded_dma.hpp
+ * @date 2024-10-17
+ * @author Robert Morley
+ *
+ * @brief Embedded Template Library : DMA descriptor chain and DMA channel driver header file.
+ *
+ * @version v0.1.0
+ * @copyright Copyright (c) 2024
+ */
+#ifndef EMBEDDED_TL_EMBEDDED_DMA_HPP
+#define EMBEDDED_TL_EMBEDDED_DMA_HPP
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#if defined(UNIT_TEST) || defined(_GLIBCXX_HAS_GTHREADS)
+#include <thread>
+#endif
+
+#include <embedded_types.hpp>
+#include <embedded_bits.hpp>
+#include <embedded_concepts.hpp>
+#include <embedded_return_type.hpp>
+#include <embedded_policy.hpp>
+#include <embedded_register.hpp>
+#include <embedded_wait.hpp>
+#include <embedded_driver.hpp>
+
+namespace embtl::dma {
+
+    /**
+     * @brief Bus address of a DMA source, destination or descriptor, the width of a pointer.
+     */
+    using bus_address = std::uintptr_t;
+
+    /**
+     * @brief Transfer width, size of one element in bytes.
+     */
+    enum class width : std::uint8_t {
+        BYTE = 1,
+        HALF_WORD = 2,
+        WORD = 4,
+        DOUBLE_WORD = 8
+    };
+
+    /**
+     * @brief Descriptor control flags.
+     */
+    enum flags : std::uint8_t {
+        NONE = 0x00,                    /**< Fixed source and destination addresses. */
+        SOURCE_INCREMENT = 0x01,        /**< Source address incremented by the width after each element. */
+        DESTINATION_INCREMENT = 0x02,   /**< Destination address incremented by the width after each element. */
+        INTERRUPT = 0x04                /**< Interrupt when the descriptor is completed. */
+    };
+
+    constexpr flags operator|(const flags lhs, const flags rhs) noexcept {
+      return static_cast<flags>(static_cast<std::uint8_t>(lhs) | static_cast<std::uint8_t>(rhs));
+    }
+
+    /**
+     * @brief DMA descriptor, one block transfer of a scatter-gather chain (linked list item).
+     * @note Created with memory_to_memory(), memory_to_peripheral() or peripheral_to_memory(), the next address is set
+     *       when the chain is placed in descriptor memory, see place().
+     */
+    struct descriptor final {
+        bus_address source;         /**< Address of the first source element. */
+        bus_address destination;    /**< Address of the first destination element. */
+        std::uint32_t count;        /**< Number of elements. */
+        width element_width;        /**< Element size. */
+        flags control;              /**< Increment and interrupt flags. */
+        std::uint16_t reserved;     /**< Padding, 0. */
+        bus_address next;           /**< Address of the next descriptor, 0 := last descriptor. */
+
+        /**
+         * @brief Number of bytes transferred by the descriptor.
+         */
+        [[nodiscard]] constexpr std::size_t bytes() const noexcept {
+          return std::size_t{count} * static_cast<std::size_t>(element_width);
+        }
+    };
+    static_assert(std::is_trivially_copyable_v<descriptor> && std::is_standard_layout_v<descriptor>);
+
+    /**
+     * @brief Transfer width of an element type.
+     * @tparam T Element type, see dma_element_type.
+     */
+    template<dma_element_type T>
+    inline constexpr width width_of = static_cast<width>(sizeof(T));
+
+    /**
+     * @brief Checks a descriptor.
+     * @param item [in] Descriptor.
+     * @return STATUS::OK := valid descriptor; STATUS::INVALID_PARAMETER := unknown width, no element, null address or
+     *         address not aligned to the width.
+     */
+    constexpr STATUS validate(const descriptor& item) noexcept {
+      const auto size = static_cast<bus_address>(item.element_width);
+      if(!std::has_single_bit(size) || size > sizeof(std::uint64_t)){
+        return STATUS::INVALID_PARAMETER;
+      }
+      if(item.count == 0 || item.source == 0 || item.destination == 0){
+        return STATUS::INVALID_PARAMETER;
+      }
+      if((item.source % size) != 0 || (item.destination % size) != 0){
+        return STATUS::INVALID_PARAMETER;
+      }
+      return STATUS::OK;
+    }
+
+    namespace details {
+        /**
+         * @brief Not constexpr, called from make_chain() to generate a compile time error.
+         */
+        inline void invalid_dma_descriptor() noexcept { }
+
+        inline bus_address bus_address_of(const volatile void* ptr) noexcept {
+          return reinterpret_cast<bus_address>(ptr);
+        }
+    }
+
+    /**
+     * @brief Creates a memory to memory descriptor, source and destination incremented.
+     * @tparam T Element type, sets the transfer width.
+     * @param source [in] Source address.
+     * @param destination [in] Destination address.
+     * @param count [in] Number of elements.
+     * @param extra [in] Additional flags, ex: INTERRUPT. (default = NONE)
+     * @return Descriptor.
+     */
+    template<dma_element_type T>
+    constexpr descriptor memory_to_memory(const bus_address source, const bus_address destination,
+                                          const std::uint32_t count, const flags extra = NONE) noexcept {
+      return { source, destination, count, width_of<T>, SOURCE_INCREMENT | DESTINATION_INCREMENT | extra, 0, 0 };
+    }
+    /**
+     * @brief Creates a memory to peripheral descriptor, source incremented, fixed destination register.
+     * @tparam T Element type, sets the transfer width.
+     * @param source [in] Source address.
+     * @param destination [in] Peripheral register address.
+     * @param count [in] Number of elements.
+     * @param extra [in] Additional flags, ex: INTERRUPT. (default = NONE)
+     * @return Descriptor.
+     */
+    template<dma_element_type T>
+    constexpr descriptor memory_to_peripheral(const bus_address source, const bus_address destination,
+                                              const std::uint32_t count, const flags extra = NONE) noexcept {
+      return { source, destination, count, width_of<T>, SOURCE_INCREMENT | extra, 0, 0 };
+    }
+    /**
+     * @brief Creates a peripheral to memory descriptor, fixed source register, destination incremented.
+     * @tparam T Element type, sets the transfer width.
+     * @param source [in] Peripheral register address.
+     * @param destination [in] Destination address.
+     * @param count [in] Number of elements.
+     * @param extra [in] Additional flags, ex: INTERRUPT. (default = NONE)
+     * @return Descriptor.
+     */
+    template<dma_element_type T>
+    constexpr descriptor peripheral_to_memory(const bus_address source, const bus_address destination,
+                                              const std::uint32_t count, const flags extra = NONE) noexcept {
+      return { source, destination, count, width_of<T>, DESTINATION_INCREMENT | extra, 0, 0 };
+    }
+    /**
+     * @brief Creates a memory to memory descriptor from typed buffers.
+     * @param source [in] Source buffer.
+     * @param destination [in] Destination buffer, same element type.
+     * @param count [in] Number of elements.
+     * @param extra [in] Additional flags. (default = NONE)
+     * @return Descriptor.
+     */
+    template<dma_element_type T>
+    descriptor memory_to_memory(const T* source, T* destination, const std::uint32_t count, const flags extra = NONE) noexcept {
+      return memory_to_memory<T>(details::bus_address_of(source), details::bus_address_of(destination), count, extra);
+    }
+    /**
+     * @brief Creates a memory to peripheral descriptor, the element type is the register value type.
+     * @param source [in] Source buffer.
+     * @param reg [in] Peripheral register, ex: reg_map->DR.
+     * @param count [in] Number of elements.
+     * @param extra [in] Additional flags. (default = NONE)
+     * @return Descriptor.
+     */
+    template<mmio_hardware_register Reg>
+    descriptor memory_to_peripheral(const typename Reg::value_type* source, Reg& reg, const std::uint32_t count,
+                                    const flags extra = NONE) noexcept {
+      static_assert(Reg::has_write_access(), "Register does not have write access.");
+      return memory_to_peripheral<typename Reg::value_type>(details::bus_address_of(source), details::bus_address_of(&reg), count, extra);
+    }
+    /**
+     * @brief Creates a peripheral to memory descriptor, the element type is the register value type.
+     * @param reg [in] Peripheral register, ex: reg_map->DR.
+     * @param destination [in] Destination buffer.
+     * @param count [in] Number of elements.
+     * @param extra [in] Additional flags. (default = NONE)
+     * @return Descriptor.
+     */
+    template<mmio_hardware_register Reg>
+    descriptor peripheral_to_memory(const Reg& reg, typename Reg::value_type* destination, const std::uint32_t count,
+                                    const flags extra = NONE) noexcept {
+      static_assert(Reg::has_read_access(), "Register does not have read access.");
+      return peripheral_to_memory<typename Reg::value_type>(details::bus_address_of(&reg), details::bus_address_of(destination), count, extra);
+    }
+
+    /**
+     * @brief Chain link mode.
+     */
+    enum class link : std::uint8_t {
+        LINEAR,     /**< The last descriptor ends the chain. */
+        CIRCULAR    /**< The last descriptor links to the first one, ex: continuous ADC sampling. */
+    };
+
+    /**
+     * @brief Scatter-gather chain of N descriptors, not linked yet.
+     * @tparam N Number of descriptors.
+     * @note Created with make_chain(), linked in descriptor memory with place().
+     */
+    template<std::size_t N>
+    requires (N > 0)
+    struct chain final {
+      public:
+        static constexpr std::size_t size() noexcept { return N; }
+        /**
+         * @brief Number of bytes transferred by one pass of the chain.
+         */
+        [[nodiscard]] constexpr std::size_t bytes() const noexcept {
+          std::size_t total = 0;
+          for(const auto& item : descriptors){
+            total += item.bytes();
+          }
+          return total;
+        }
+
+        std::array<descriptor, N> descriptors;
+        link mode;
+    };
+
+    /**
+     * @brief Creates a scatter-gather chain.
+     * @tparam Mode Link mode. (default = link::LINEAR)
+     * @param items [in] Descriptors, in transfer order.
+     * @return Chain.
+     * @note When evaluated at compile time (constexpr chain), a compile time error is generated if a descriptor is not
+     *       valid, see validate(). Chains built at run time are checked by place().
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  constexpr auto dac_chain = embtl::dma::make_chain<embtl::dma::link::CIRCULAR>(
+     *      embtl::dma::memory_to_peripheral<std::uint16_t>(0x2000'0000, 0x4000'7408, 64),
+     *      embtl::dma::memory_to_peripheral<std::uint16_t>(0x2000'0080, 0x4000'7408, 64, embtl::dma::INTERRUPT)
+     *  );
+     *
+     * @endcode
+     */
+    template<link Mode = link::LINEAR, std::same_as<descriptor> ... Descriptors>
+    requires (sizeof...(Descriptors) > 0)
+    constexpr auto make_chain(const Descriptors ... items) noexcept -> chain<sizeof...(Descriptors)> {
+      if(std::is_constant_evaluated()){
+        for(const auto& item : { items ... }){
+          if(validate(item) != STATUS::OK){
+            details::invalid_dma_descriptor();
+          }
+        }
+      }
+      return { { items ... }, Mode };
+    }
+
+    /**
+     * @brief Default alignment of a descriptor block, one Cortex-M7 cache line.
+     */
+    inline constexpr std::size_t descriptor_alignment = 32;
+
+    /**
+     * @brief Descriptor memory of N descriptors, the DMA engine reads the descriptors from this block.
+     * @tparam N Number of descriptors.
+     * @tparam Tag Block tag, gives chains of the same size their own block type in a basic_section_allocator<>.
+     * @tparam Alignment Block alignment. (default = descriptor_alignment)
+     * @note Place the block in memory the DMA engine can read without cache maintenance, ex: a non-cacheable section.
+     */
+    template<std::size_t N, typename Tag = void, std::size_t Alignment = descriptor_alignment>
+    requires (N > 0 && std::has_single_bit(Alignment) && Alignment >= alignof(descriptor))
+    struct alignas(Alignment) descriptor_block {
+      public:
+        using tag = Tag;
+
+        static constexpr std::size_t size() noexcept { return N; }
+
+        std::array<descriptor, N> descriptors;
+    };
+
+    /**
+     * @brief Copies a chain into descriptor memory and links the descriptors.
+     * @param items [in] Chain, see make_chain().
+     * @param block [in] Descriptor memory, at least N descriptors.
+     * @return First descriptor of the chain; STATUS::OK := chain placed; STATUS::INVALID_PARAMETER := a descriptor is
+     *         not valid, the block is not changed.
+     */
+    template<std::size_t N, std::size_t M, typename Tag, std::size_t Alignment>
+    requires (N <= M)
+    auto place(const chain<N>& items, descriptor_block<M, Tag, Alignment>& block) noexcept
+    -> basic_return_value_status<const descriptor*, nullptr> {
+      for(const auto& item : items.descriptors){
+        if(validate(item) != STATUS::OK){
+          return { nullptr, STATUS::INVALID_PARAMETER };
+        }
+      }
+
+      for(std::size_t i = 0; i < N; ++i){
+        auto& item = block.descriptors[i];
+        item = items.descriptors[i];
+        if(i + 1 < N){
+          item.next = details::bus_address_of(&block.descriptors[i + 1]);
+        } else {
+          item.next = items.mode == link::CIRCULAR ? details::bus_address_of(&block.descriptors[0]) : 0;
+        }
+      }
+      return { block.descriptors.data(), STATUS::OK };
+    }
+    /**
+     * @brief Copies a chain into the descriptor block of a memory section allocator and links the descriptors.
+     * @tparam Allocator Memory section allocator, see basic_section_allocator<>.
+     * @tparam Block Descriptor block type, one of the allocator objects.
+     * @param items [in] Chain, see make_chain().
+     * @return First descriptor of the chain; STATUS::OK := chain placed; STATUS::INVALID_PARAMETER := a descriptor is
+     *         not valid.
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  using dac_block_t = embtl::dma::descriptor_block<2, struct dac_tag>;
+     *  EMBEDDED_MEMORY_SECTION(dma_section, ".dma_nocache", 1024, 32, dac_block_t);
+     *  using dma_allocator_t = embtl::basic_section_allocator<dma_section>;
+     *
+     *  const auto first = embtl::dma::place<dma_allocator_t, dac_block_t>(dac_chain);
+     *  dma1.start(first.get_value());
+     *
+     * @endcode
+     */
+    template<typename Allocator, typename Block, std::size_t N>
+    auto place(const chain<N>& items) noexcept -> basic_return_value_status<const descriptor*, nullptr> {
+      return place(items, *Allocator::template get<Block>());
+    }
+
+    /**
+     * @brief DMA channel register, holds bus addresses.
+     */
+    using channel_register = basic_hardware_register<policy::basic_reg_read_write_atomic<bus_address>, bus_address>;
+
+    /**
+     * @brief Generic linked list DMA channel register map.
+     */
+    struct channel_register_map {
+        channel_register CR;    /**< Control : EN, IE, ABORT. */
+        channel_register SR;    /**< Status : BUSY, DONE, ERROR, ABORTED, set by the DMA engine. */
+        channel_register LAR;   /**< Link address : first descriptor of the chain. */
+        channel_register CDAR;  /**< Current descriptor address. */
+        channel_register NDTR;  /**< Number of descriptors completed. */
+    };
+
+    using CR_EN = field<0>;         /**< Channel enable, cleared by the engine at the end of the chain. */
+    using CR_IE = field<1>;         /**< Interrupt at the end of the chain. */
+    using CR_ABORT = field<2>;      /**< Stops the chain before the next descriptor. */
+
+    using SR_BUSY = field<0>;       /**< Chain in progress. */
+    using SR_DONE = field<1>;       /**< Chain completed. */
+    using SR_ERROR = field<2>;      /**< Invalid descriptor, CDAR holds its address. */
+    using SR_ABORTED = field<3>;    /**< Chain stopped by CR_ABORT. */
+
+#if defined(UNIT_TEST) || defined(_GLIBCXX_HAS_GTHREADS)
+    /**
+     * @brief Host stand-in of a DMA channel, a worker thread runs the chains started on the channel registers.
+     * @tparam DeviceIoRegion Channel device region type, the register map is channel_register_map and the allocator a
+     *         basic_mmio_single_device_allocator<>, the engine and the driver share the same registers.
+     * @details
+     * The worker thread waits for CR_EN, then walks the chain from LAR: each descriptor is copied with memcpy (one
+     * memcpy per element if an address is fixed), CDAR and NDTR are updated, and the handler is called for the
+     * descriptors with the INTERRUPT flag. At the end of the chain CR is cleared and SR is set to DONE, ERROR or
+     * ABORTED; the handler is called if CR_IE was set. The handler runs on the worker thread, like an interrupt.
+     * @note Compiled for host builds (UNIT_TEST) or toolchains with threads (_GLIBCXX_HAS_GTHREADS).
+     */
+    template<typename DeviceIoRegion>
+    requires std::is_base_of_v<channel_register_map, DeviceIoRegion>
+    class host_engine final {
+      public:
+        using handler_type = void (*)(void* context) noexcept;
+
+        explicit host_engine(const handler_type irq_handler = nullptr, void* const irq_context = nullptr)
+                : reg_map(new DeviceIoRegion), handler(irq_handler), context(irq_context), worker([this](){ run(); }) { }
+
+        host_engine(const host_engine&) = delete;
+        host_engine& operator=(const host_engine&) = delete;
+
+        ~host_engine() {
+          stop.store(true, std::memory_order_release);
+          worker.join();
+        }
+        /**
+         * @brief Number of chains run since the engine was created.
+         */
+        [[nodiscard]] std::size_t chains() const noexcept { return runs.load(std::memory_order_acquire); }
+
+      private:
+        void run() noexcept {
+          while(!stop.load(std::memory_order_acquire)){
+            if(reg_map == nullptr || reg_map->CR.template get<CR_EN>() == 0){
+              std::this_thread::yield();
+              continue;
+            }
+            execute(*reg_map);
+          }
+        }
+
+        void execute(channel_register_map& regs) noexcept {
+          const bool chain_interrupt = regs.CR.template get<CR_IE>() != 0;
+          regs.SR.write(SR_BUSY::mask<bus_address>());
+          regs.NDTR.write(0);
+
+          auto status = SR_DONE::mask<bus_address>();
+          bus_address completed = 0;
+          for(auto address = regs.LAR.read(); address != 0; ){
+            if(regs.CR.template get<CR_ABORT>() != 0){
+              status = SR_ABORTED::mask<bus_address>();
+              break;
+            }
+            regs.CDAR.write(address);
+            const auto& item = *reinterpret_cast<const descriptor*>(address);
+            if(validate(item) != STATUS::OK){
+              status = SR_ERROR::mask<bus_address>();
+              break;
+            }
+            copy(item);
+            regs.NDTR.write(++completed);
+            if((item.control & INTERRUPT) != 0){
+              interrupt();
+            }
+            address = item.next;
+          }
+
+          regs.CR.write(0);
+          regs.SR.write(status);
+          runs.fetch_add(1, std::memory_order_release);
+          if(chain_interrupt){
+            interrupt();
+          }
+        }
+
+        static void copy(const descriptor& item) noexcept {
+          const auto size = static_cast<std::size_t>(item.element_width);
+          const auto* source = reinterpret_cast<const std::byte*>(item.source);
+          auto* destination = reinterpret_cast<std::byte*>(item.destination);
+
+          if((item.control & SOURCE_INCREMENT) != 0 && (item.control & DESTINATION_INCREMENT) != 0){
+            std::memcpy(destination, source, item.bytes());
+            return;
+          }
+          for(std::uint32_t i = 0; i < item.count; ++i){
+            std::memcpy(destination, source, size);
+            if((item.control & SOURCE_INCREMENT) != 0){
+              source += size;
+            }
+            if((item.control & DESTINATION_INCREMENT) != 0){
+              destination += size;
+            }
+          }
+        }
+
+        void interrupt() const noexcept {
+          if(handler != nullptr){
+            handler(context);
+          }
+        }
+
+        DeviceIoRegion* reg_map;
+        handler_type handler;
+        void* context;
+        std::atomic<bool> stop { false };
+        std::atomic<std::size_t> runs { 0 };
+        std::thread worker;
+    };
+#endif
+}
+
+namespace embtl {
+
+    /**
+     * @brief DMA channel driver skeleton, starts descriptor chains on a linked list DMA channel.
+     * @tparam DeviceIoRegion Channel device region type, the register map is dma::channel_register_map or derived
+     *         from it.
+     * @details
+     * start() writes the first descriptor address to LAR and sets CR_EN, the engine walks the chain without the CPU.
+     * wait() polls SR until DONE, ERROR or ABORTED. Device drivers derive from this class to add the request routing
+     * and the peripheral side configuration of their DMA controller.
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  using dma1_region_t = embtl::basic_device_region<embtl::dma::channel_register_map,
+     *                                                   embtl::basic_mmio_single_device_allocator<{0x4002'0008}>>;
+     *
+     *  embtl::basic_dma_channel<dma1_region_t> dma1;
+     *  dma1.start(first_descriptor);
+     *  ...
+     *  if(dma1.wait(100'000).has_error()){ ... }
+     *
+     * @endcode
+     *
+     * @note Unit Tested.
+     */
+    template<typename DeviceIoRegion>
+    requires std::is_base_of_v<dma::channel_register_map, DeviceIoRegion>
+    struct basic_dma_channel : public basic_driver<DeviceIoRegion> {
+      protected:
+        using basic_driver<DeviceIoRegion>::reg_map;
+
+      public:
+        /**
+         * @brief Starts a descriptor chain.
+         * @param first [in] First descriptor, in descriptor memory, see dma::place().
+         * @param interrupt [in] true := interrupt at the end of the chain. (default = false)
+         * @return STATUS::OK := chain started; STATUS::BUSY := a chain is in progress; STATUS::INVALID_PARAMETER :=
+         *         first is nullptr; STATUS::UNINITIALIZED := no register map.
+         */
+        STATUS start(const dma::descriptor* first, const bool interrupt = false) noexcept {
+          if(this->has_error()){
+            return STATUS::UNINITIALIZED;
+          }
+          if(first == nullptr){
+            return STATUS::INVALID_PARAMETER;
+          }
+          if(busy()){
+            return STATUS::BUSY;
+          }
+          reg_map->SR.write(0);
+          reg_map->LAR.write(dma::details::bus_address_of(first));
+          reg_map->CR.write_fields(dma::CR_EN{} = 1U, dma::CR_IE{} = interrupt ? 1U : 0U);
+          return STATUS::OK;
+        }
+        /**
+         * @brief Checks if a chain is in progress.
+         */
+        [[nodiscard]] bool busy() noexcept {
+          return reg_map->CR.template get<dma::CR_EN>() != 0 || reg_map->SR.template get<dma::SR_BUSY>() != 0;
+        }
+        /**
+         * @brief Requests the end of the chain before the next descriptor.
+         * @return STATUS::OK := no chain in progress; STATUS::BUSY := abort requested, see wait().
+         */
+        STATUS abort() noexcept {
+          if(!busy()){
+            return STATUS::OK;
+          }
+          reg_map->CR.template set<dma::CR_ABORT>(1U);
+          return STATUS::BUSY;
+        }
+        /**
+         * @brief Waits for the end of the chain, reads SR at most timeout times.
+         * @tparam Backoff Backoff policy called between two reads, see embtl::wait. (default = wait::spin)
+         * @param timeout [in] Maximum number of status register reads.
+         * @return Last SR value; STATUS::OK := chain completed; STATUS::TIMEOUT := timeout; STATUS::ERROR := invalid
+         *         descriptor or chain aborted.
+         */
+        template<wait_backoff_policy Backoff = wait::spin>
+        auto wait(const std::size_t timeout) noexcept -> basic_return_value_status<dma::bus_address, 0> {
+          constexpr auto stopped = fields_mask<dma::bus_address, dma::SR_ERROR, dma::SR_ABORTED>();
+          return reg_map->SR.template wait_any<Backoff>(dma::SR_DONE::mask<dma::bus_address>() | stopped, timeout, stopped);
+        }
+        /**
+         * @brief Number of descriptors completed by the current or last chain.
+         */
+        [[nodiscard]] std::size_t completed() noexcept { return reg_map->NDTR.read(); }
+        /**
+         * @brief Descriptor in progress, or the invalid descriptor after an error.
+         */
+        [[nodiscard]] const dma::descriptor* current() noexcept {
+          return reinterpret_cast<const dma::descriptor*>(reg_map->CDAR.read());
+        }
+    };
+}
+
+#endif //EMBEDDED_TL_EMBEDDED_DMA_HPP
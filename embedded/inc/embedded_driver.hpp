@@ -11,6 +11,8 @@
 #ifndef EMBEDDED_TL_EMBEDDED_DRIVER_HPP
 #define EMBEDDED_TL_EMBEDDED_DRIVER_HPP
 
+#include <embedded_types.hpp>
+#include <embedded_allocator.hpp>
 #include <embedded_region.hpp>
 
 namespace embtl {
@@ -33,6 +35,121 @@ namespace embtl {
         DeviceIoRegion* reg_map;
     };
 
+    namespace details {
+        /**
+         * @brief Compile time base address of a device allocator, 0 if the address is not known at compile time.
+         * @tparam Alloc Device allocator type.
+         */
+        template<typename Alloc>
+        struct static_base_address : std::integral_constant<address_t, 0> { };
+
+        template<memory_mapped_device_info Device, typename HostAlloc>
+        requires (!HostAlloc::value)
+        struct static_base_address<basic_mmio_single_device_allocator<Device, HostAlloc>>
+                : std::integral_constant<address_t, Device.base_address> { };
+
+        /**
+         * @brief Device allocator of a device region type.
+         * @tparam DeviceIoRegion Device region type.
+         */
+        template<typename DeviceIoRegion>
+        struct region_allocator {
+            using type = void;
+        };
+
+        template<typename RegisterMap, typename Alloc>
+        struct region_allocator<basic_device_region<RegisterMap, Alloc>> {
+            using type = Alloc;
+        };
+
+        template<typename RegisterMap, typename Alloc>
+        struct region_allocator<basic_mmio_device_registers<RegisterMap, Alloc>> {
+            using type = Alloc;
+        };
+
+        /**
+         * @brief Device region pointer with a compile time address, has no storage.
+         * @tparam DeviceIoRegion Device region type.
+         * @tparam Address Device region base address.
+         */
+        template<typename DeviceIoRegion, address_t Address>
+        struct static_region_pointer final {
+          public:
+            DeviceIoRegion* operator->() const noexcept { return reinterpret_cast<DeviceIoRegion*>(Address); }
+            DeviceIoRegion& operator*() const noexcept { return *reinterpret_cast<DeviceIoRegion*>(Address); }
+        };
+    }
+
+    /**
+     * @brief Checks if the device region has a base address known at compile time, ex: a device region with a
+     *        basic_mmio_single_device_allocator<> that is not a host allocator.
+     * @tparam DeviceIoRegion Device region type.
+     */
+    template<typename DeviceIoRegion>
+    concept static_device_region = details::static_base_address<typename details::region_allocator<DeviceIoRegion>::type>::value != 0;
+
+    /**
+     * @brief Device driver base class with a compile time register map address, an empty class.
+     * @tparam DeviceIoRegion Device region type with a compile time base address, see static_device_region.
+     *
+     * @details
+     * Same use as basic_driver, reg_map->REG accesses the registers, but reg_map is a static member without storage
+     * that resolves to the constant base address. Register accesses do not load a pointer from RAM and has_error() is
+     * evaluated at compile time.
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  using rcc_registers_t = embtl::basic_device_region<rcc_register_map, embtl::basic_mmio_single_device_allocator<{0x4002'1000}>>;
+     *
+     *  class rcc_driver final : public embtl::static_driver<rcc_registers_t> {
+     *    public:
+     *      void enable_hse() noexcept { reg_map->CR |= RCC_CR_HSEON; }
+     *  };
+     *  static_assert(std::is_empty_v<rcc_driver>);
+     *
+     * @endcode
+     */
+    template<typename DeviceIoRegion>
+    requires static_device_region<DeviceIoRegion>
+    struct static_driver {
+      public:
+        static constexpr address_t base_address = details::static_base_address<typename details::region_allocator<DeviceIoRegion>::type>::value;
+
+        static_driver() noexcept = default;
+
+        static_driver(const static_driver&) noexcept = default;
+        static_driver& operator=(const static_driver&) noexcept = default;
+        static_driver(static_driver&&) noexcept = delete;
+        static_driver& operator=(static_driver&&) noexcept = delete;
+
+        [[nodiscard]] static consteval auto has_error() noexcept -> bool {
+          return base_address == 0;
+        }
+
+      protected:
+        static constexpr details::static_region_pointer<DeviceIoRegion, base_address> reg_map { };
+    };
+
+    namespace details {
+        template<typename DeviceIoRegion, bool Static = static_device_region<DeviceIoRegion>>
+        struct driver_base {
+            using type = basic_driver<DeviceIoRegion>;
+        };
+
+        template<typename DeviceIoRegion>
+        struct driver_base<DeviceIoRegion, true> {
+            using type = static_driver<DeviceIoRegion>;
+        };
+    }
+
+    /**
+     * @brief Driver base class of a device region, static_driver if the base address is known at compile time,
+     *        otherwise basic_driver.
+     * @tparam DeviceIoRegion Device region type.
+     */
+    template<typename DeviceIoRegion>
+    using driver_base_t = typename details::driver_base<DeviceIoRegion>::type;
 }
 
 #endif //EMBEDDED_TL_EMBEDDED_DRIVER_HPP
@@ -0,0 +1,253 @@
+/**
+ * @file embedded_init.hpp
+ * @date 2024-10-16
+ * @author Robert Morley
+ *
+ * @brief Embedded Template Library : Compile time peripheral init table header file.
+ *
+ * @version v0.1.0
+ * @copyright Copyright (c) 2024
+ */
+#ifndef EMBEDDED_TL_EMBEDDED_INIT_HPP
+#define EMBEDDED_TL_EMBEDDED_INIT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <limits>
+
+#include <embedded_types.hpp>
+#include <embedded_bits.hpp>
+#include <embedded_concepts.hpp>
+#include <embedded_return_type.hpp>
+#include <embedded_register.hpp>
+#include <embedded_region.hpp>
+
+/**
+ * @brief Register template arguments of the init entry functions, the register member pointer and its offset.
+ * @param map Register map class.
+ * @param member Register member name.
+ * @details
+ * A member pointer offset is not a constant expression in C++20, the offset is taken with offsetof() from the same
+ * member name, so the register type and the offset can not refer to different registers.
+ *
+ * @example
+ * @code{.cpp}
+ *
+ *  embtl::init::write<EMBEDDED_INIT_REGISTER(uart_register_map, BAUD)>(0x68)
+ *
+ * @endcode
+ */
+#define EMBEDDED_INIT_REGISTER(map, member) &map::member, offsetof(map, member)
+
+namespace embtl::init {
+
+    /**
+     * @brief Init table entry operation.
+     */
+    enum class op : std::uint8_t {
+        WRITE,      /**< register = value. */
+        MODIFY,     /**< register = (register & ~mask) | value. */
+        WAIT,       /**< read register until (register & mask) == value, at most count reads. */
+        DELAY       /**< busy loop of count iterations. */
+    };
+
+    /**
+     * @brief Init table entry, one register operation.
+     */
+    struct entry final {
+        std::uint16_t offset;   /**< Register byte offset in the register map. */
+        op operation;           /**< Register operation. */
+        arch_type mask;         /**< Bits changed or compared. */
+        arch_type value;        /**< Bits written or expected, within mask. */
+        std::uint32_t count;    /**< WAIT: maximum number of reads; DELAY: number of loops. */
+    };
+
+    namespace details {
+        /**
+         * @brief Checks if a register policy is a plain read-only, write-only or read/write policy without lock.
+         * @details
+         * run() accesses the registers directly at their offset, only policies whose access is a plain load or store
+         * are accepted. Shadowed, atomic, aliased, locked, write-one-to-clear and read-to-clear registers are rejected,
+         * their policy must run on every access.
+         */
+        template<typename Policy>
+        struct is_plain_policy : std::false_type { };
+
+        template<embedded_base_type Base, typename SideEffect, bool EffectBefore>
+        struct is_plain_policy<policy::basic_reg_read_only<Base, SideEffect, EffectBefore>> : std::true_type { };
+
+        template<embedded_base_type Base, Base Mask, typename SideEffect>
+        struct is_plain_policy<policy::basic_reg_write_only<Base, Mask, SideEffect>> : std::true_type { };
+
+        template<embedded_base_type Base, Base Mask, typename SideEffect, bool EffectBefore>
+        struct is_plain_policy<policy::basic_reg_read_write<Base, Mask, SideEffect, EffectBefore, lock::no_lock>> : std::true_type { };
+
+        /**
+         * @brief Checks the register of a member pointer and its offset, the offset must fit in entry::offset.
+         * @tparam Member Register member pointer.
+         * @tparam Offset Register byte offset.
+         */
+        template<auto Member, std::size_t Offset>
+        consteval void check_register() noexcept {
+          using reg_type = register_member_t<Member>;
+          using map_type = typename embtl::details::member_pointer_traits<decltype(Member)>::class_type;
+          static_assert(mmio_hardware_register<reg_type>, "Init table entries require a register type.");
+          static_assert(is_plain_policy<register_access_policy<reg_type>>::value,
+                        "Init table registers must have a plain read-only, write-only or read/write policy.");
+          static_assert(std::is_same_v<typename reg_type::value_type, arch_type>, "Init table registers must be arch_type.");
+          static_assert(Offset <= std::numeric_limits<std::uint16_t>::max(), "Register offset does not fit in the init table entry.");
+          static_assert(Offset + sizeof(reg_type) <= sizeof(map_type) && (Offset % alignof(reg_type)) == 0,
+                        "Register offset is outside of the register map or not aligned.");
+        }
+    }
+
+    /**
+     * @brief Creates a register write entry.
+     * @tparam Member Register member pointer, ex: &uart_register_map::BAUD.
+     * @tparam Offset Register byte offset, ex: offsetof(uart_register_map, BAUD). See EMBEDDED_INIT_REGISTER.
+     * @param value [in] Register value, masked by the register WriteMask().
+     * @return Init table entry.
+     */
+    template<auto Member, std::size_t Offset>
+    consteval entry write(const arch_type value) noexcept {
+      using reg_type = register_member_t<Member>;
+      details::check_register<Member, Offset>();
+      static_assert(reg_type::has_write_access(), "Register does not have write access.");
+      return { static_cast<std::uint16_t>(Offset), op::WRITE, reg_type::WriteMask(), static_cast<arch_type>(value & reg_type::WriteMask()), 0 };
+    }
+    /**
+     * @brief Creates a register bit field modify entry, one read and one write of the register.
+     * @tparam Member Register member pointer, ex: &uart_register_map::CTRL.
+     * @tparam Offset Register byte offset, ex: offsetof(uart_register_map, CTRL). See EMBEDDED_INIT_REGISTER.
+     * @param values [in] Field assignments, ex: init::modify<EMBEDDED_INIT_REGISTER(map, CTRL)>(FIELD_A{} = 1, FIELD_B{} = 2).
+     * @return Init table entry.
+     */
+    template<auto Member, std::size_t Offset, register_bit_field ... Fields, typename ... Ts>
+    requires (sizeof...(Fields) > 0)
+    consteval entry modify(const field_assignment<Fields, Ts> ... values) noexcept {
+      using reg_type = register_member_t<Member>;
+      details::check_register<Member, Offset>();
+      static_assert(reg_type::has_read_write_access(), "Register does not have read/write access.");
+      static_assert(fields_fit<arch_type, Fields...>(), "Field is outside of the register value type.");
+      static_assert((fields_mask<arch_type, Fields...>() & ~reg_type::WriteMask()) == 0, "Field overlaps bits outside of the register write mask.");
+      static_assert(fields_disjoint<arch_type, Fields...>(), "Fields overlap each other.");
+      return { static_cast<std::uint16_t>(Offset), op::MODIFY, fields_mask<arch_type, Fields...>(), insert_fields<arch_type>(values...), 0 };
+    }
+    /**
+     * @brief Creates a wait entry, the table walk stops with STATUS::TIMEOUT if the field is not equal to value after
+     *        timeout reads.
+     * @tparam Member Register member pointer, ex: &rcc_register_map::CR.
+     * @tparam Offset Register byte offset, ex: offsetof(rcc_register_map, CR). See EMBEDDED_INIT_REGISTER.
+     * @tparam Field Bit field descriptor, see embtl::field<>.
+     * @param value [in] Field value, not shifted.
+     * @param timeout [in] Maximum number of register reads.
+     * @return Init table entry.
+     */
+    template<auto Member, std::size_t Offset, register_bit_field Field>
+    consteval entry wait(const field_value_t<Field, arch_type> value, const std::uint32_t timeout) noexcept {
+      using reg_type = register_member_t<Member>;
+      details::check_register<Member, Offset>();
+      static_assert(reg_type::has_read_access(), "Register does not have read access.");
+      static_assert(fields_fit<arch_type, Field>(), "Field is outside of the register value type.");
+      return { static_cast<std::uint16_t>(Offset), op::WAIT, fields_mask<arch_type, Field>(), insert_field<arch_type, Field>(value), timeout };
+    }
+    /**
+     * @brief Creates a delay entry.
+     * @param loops [in] Number of busy loop iterations.
+     * @return Init table entry.
+     */
+    consteval entry delay(const std::uint32_t loops) noexcept {
+      return { 0, op::DELAY, 0, 0, loops };
+    }
+
+    /**
+     * @brief Init table of a register map.
+     * @tparam RegisterMap Register map class.
+     * @tparam N Number of entries.
+     * @note Created with make_table<RegisterMap>().
+     */
+    template<typename RegisterMap, std::size_t N>
+    requires (std::is_class_v<RegisterMap> && std::is_standard_layout_v<RegisterMap>)
+    struct table final {
+      public:
+        using register_map = RegisterMap;
+
+        static constexpr std::size_t size() noexcept { return N; }
+
+        std::array<entry, N> entries;
+    };
+
+    /**
+     * @brief Creates an init table, the register offsets are checked against the register map.
+     * @tparam RegisterMap Register map class.
+     * @param entries [in] Init table entries, see write(), modify(), wait() and delay().
+     * @return Init table.
+     * @note The register offsets are checked when the entries are created, see EMBEDDED_INIT_REGISTER.
+     */
+    template<typename RegisterMap, std::same_as<entry> ... Entries>
+    consteval auto make_table(const Entries ... entries) noexcept -> table<RegisterMap, sizeof...(Entries)> {
+      return { { entries ... } };
+    }
+
+    /**
+     * @brief Replays an init table against a register map, the entries are executed in order.
+     * @param registers [in] Register map, basic_device_region<> or basic_mmio_device_registers<>.
+     * @param init_table [in] Init table.
+     * @return Number of entries executed; STATUS::OK := all entries executed; STATUS::TIMEOUT := a wait entry timed
+     *         out, the value is the index of that entry.
+     * @details
+     * The registers are accessed directly at their offset, the access policy side effects are not called. The access
+     * checks of the register types are done when the table is created, only plain read-only, write-only and
+     * read/write policies are accepted so a direct access is what the policy would do.
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  constexpr auto uart_init = embtl::init::make_table<uart_register_map>(
+     *      embtl::init::write<EMBEDDED_INIT_REGISTER(uart_register_map, BAUD)>(0x68),
+     *      embtl::init::modify<EMBEDDED_INIT_REGISTER(uart_register_map, CTRL)>(UART_CTRL_TXEN{} = 1, UART_CTRL_RXEN{} = 1),
+     *      embtl::init::wait<EMBEDDED_INIT_REGISTER(uart_register_map, STAT), UART_STAT_READY>(1, 1000)
+     *  );
+     *
+     *  if(embtl::init::run(*reg_map, uart_init).has_error()){ ... }
+     *
+     * @endcode
+     */
+    template<typename Registers, typename RegisterMap, std::size_t N>
+    requires std::is_base_of_v<RegisterMap, Registers>
+    auto run(Registers& registers, const table<RegisterMap, N>& init_table) noexcept -> basic_return_value_status<std::size_t, 0> {
+      auto* const base = reinterpret_cast<volatile std::byte*>(static_cast<RegisterMap*>(&registers));
+
+      for(std::size_t i = 0; i < N; ++i){
+        const auto& item = init_table.entries[i];
+        auto& reg = *reinterpret_cast<volatile arch_type*>(base + item.offset);
+
+        switch(item.operation){
+          case op::WRITE:
+            reg = item.value;
+            break;
+          case op::MODIFY:
+            reg = static_cast<arch_type>((reg & ~item.mask) | item.value);
+            break;
+          case op::WAIT: {
+            std::uint32_t reads = 0;
+            while((reg & item.mask) != item.value){
+              if(++reads >= item.count){
+                return { i, STATUS::TIMEOUT };
+              }
+            }
+            break;
+          }
+          case op::DELAY:
+            for(std::uint32_t loop = 0; loop < item.count; ++loop){
+              asm volatile ("" ::: "memory");
+            }
+            break;
+        }
+      }
+      return { N, STATUS::OK };
+    }
+}
+
+#endif //EMBEDDED_TL_EMBEDDED_INIT_HPP
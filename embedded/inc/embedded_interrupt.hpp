@@ -0,0 +1,242 @@
+/**
+ * @file embedded_interrupt.hpp
+ * @date 2024-10-17
+ * @author Robert Morley
+ *
+ * @brief Embedded Template Library : Compile time interrupt vector table header file.
+ *
+ * @version v0.1.0
+ * @copyright Copyright (c) 2024
+ */
+#ifndef EMBEDDED_TL_EMBEDDED_INTERRUPT_HPP
+#define EMBEDDED_TL_EMBEDDED_INTERRUPT_HPP
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include <embedded_types.hpp>
+
+namespace embtl::irq {
+
+    /**
+     * @brief Interrupt handler type, one entry of the vector table.
+     */
+    using handler_type = void (*)() noexcept;
+
+    namespace details {
+        template<auto Handler>
+        struct handler_traits {
+            static constexpr bool valid = false;
+        };
+
+        template<void (*Handler)() noexcept>
+        struct handler_traits<Handler> {
+            static constexpr bool valid = true;
+
+            static void call() noexcept { Handler(); }
+        };
+
+        template<typename Driver, void (Driver::*Handler)() noexcept>
+        struct handler_traits<Handler> {
+            static constexpr bool valid = std::is_empty_v<Driver> && std::is_default_constructible_v<Driver>;
+
+            static void call() noexcept { (Driver{}.*Handler)(); }
+        };
+
+        template<typename Driver, void (Driver::*Handler)() const noexcept>
+        struct handler_traits<Handler> {
+            static constexpr bool valid = std::is_empty_v<Driver> && std::is_default_constructible_v<Driver>;
+
+            static void call() noexcept { (Driver{}.*Handler)(); }
+        };
+    }
+
+    /**
+     * @brief Binds an interrupt number to a handler.
+     * @tparam Irq Device interrupt number.
+     * @tparam Handler Static handler (ex: &uart_driver::on_irq) or member handler of a driver without state, ex: a
+     *         static_driver<>. Handlers must be noexcept.
+     * @details
+     * The vector table entry is isr(), it calls the handler directly: a static handler is a direct call, a member
+     * handler is called on a default constructed empty driver object. The calls are usually inlined, the interrupt
+     * entry does not load a function pointer or a context pointer from RAM.
+     */
+    template<std::size_t Irq, auto Handler>
+    requires details::handler_traits<Handler>::valid
+    struct bind final {
+      public:
+        static constexpr std::size_t irq = Irq;
+
+        static void isr() noexcept { details::handler_traits<Handler>::call(); }
+    };
+
+    namespace details {
+        template<typename T>
+        struct is_binding : std::false_type { };
+
+        template<std::size_t Irq, auto Handler>
+        struct is_binding<bind<Irq, Handler>> : std::true_type { };
+    }
+
+    /**
+     * @brief Checks if T is a bind<> type.
+     * @tparam T Type to be checked.
+     */
+    template<typename T>
+    concept irq_binding = details::is_binding<T>::value;
+
+    /**
+     * @brief Interrupt vector table built at compile time.
+     * @tparam Size Number of device interrupts.
+     * @tparam Default Handler of the interrupts without binding.
+     * @tparam Bindings Interrupt bindings, see bind<>.
+     * @details
+     * vectors is a constant array of Size handlers indexed by the device interrupt number, the device part of the
+     * Cortex-M vector table that follows the 16 core exception entries. A compile time error is generated if an
+     * interrupt number is out of the table or bound twice.
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  struct uart_driver final : public embtl::static_driver<uart_region_t> {
+     *    void on_irq() noexcept { ... reg_map->SR ... }
+     *  };
+     *
+     *  using device_vectors = embtl::irq::vector_table<82, &default_handler,
+     *                                                  embtl::irq::bind<37, &uart_driver::on_irq>,
+     *                                                  embtl::irq::bind<28, &timer2_handler>>;
+     *
+     *  EMBEDDED_SECTION_ATTRIBUTE(".isr_vector.device") constinit const auto device_vector_table = device_vectors::vectors;
+     *
+     * @endcode
+     *
+     * @note Unit Tested.
+     */
+    template<std::size_t Size, handler_type Default, irq_binding ... Bindings>
+    requires (Size > 0 && Default != nullptr)
+    struct vector_table final {
+      private:
+        static consteval bool unique_bindings() noexcept {
+          std::array<bool, Size> bound { };
+          for(const auto irq : { Bindings::irq ... }){
+            if(bound[irq]){
+              return false;
+            }
+            bound[irq] = true;
+          }
+          return true;
+        }
+
+        static_assert(((Bindings::irq < Size) && ...), "Interrupt number is outside of the vector table.");
+        static_assert(unique_bindings(), "Interrupt number is bound twice.");
+
+      public:
+        using table_type = std::array<handler_type, Size>;
+
+        static constexpr std::size_t size() noexcept { return Size; }
+
+        static constexpr table_type vectors = []() {
+          table_type table { };
+          for(auto& entry : table){
+            entry = Default;
+          }
+          ((table[Bindings::irq] = &Bindings::isr), ...);
+          return table;
+        }();
+        /**
+         * @brief Checks if an interrupt number has a binding.
+         * @param irq [in] Device interrupt number.
+         * @return true := bound handler; false := default handler.
+         */
+        static constexpr bool is_bound(const std::size_t irq) noexcept {
+          return ((Bindings::irq == irq) || ...);
+        }
+    };
+
+    /**
+     * @brief Host stand-in of the interrupt controller, dispatches a vector_table<> on simulated interrupts.
+     * @tparam Table Vector table type, see vector_table<>.
+     * @details
+     * raise() marks an interrupt pending with one atomic fetch_or and can be called from any thread. dispatch() runs
+     * the pending and enabled handlers from the vector table, lowest interrupt number first, like an interrupt
+     * controller with equal priorities. Only one thread runs handlers at a time, like a single core; a dispatch() call
+     * made while another thread is dispatching returns 0.
+     */
+    template<typename Table>
+    struct host_interrupt_controller final {
+      private:
+        using word_type = std::uintptr_t;
+
+        static constexpr std::size_t word_bits = std::numeric_limits<word_type>::digits;
+        static constexpr std::size_t word_count = (Table::size() + word_bits - 1) / word_bits;
+
+        static constexpr word_type bit(const std::size_t irq) noexcept { return word_type{1} << (irq % word_bits); }
+
+      public:
+        /**
+         * @brief Raises a simulated interrupt.
+         * @param irq [in] Device interrupt number.
+         * @return STATUS::OK := interrupt pending; STATUS::OUT_OF_RANGE := irq is outside of the vector table.
+         */
+        static STATUS raise(const std::size_t irq) noexcept {
+          if(irq >= Table::size()){
+            return STATUS::OUT_OF_RANGE;
+          }
+          pending_bits[irq / word_bits].fetch_or(bit(irq), std::memory_order_release);
+          return STATUS::OK;
+        }
+
+        static void enable(const std::size_t irq) noexcept {
+          if(irq < Table::size()){
+            disabled_bits[irq / word_bits].fetch_and(~bit(irq), std::memory_order_release);
+          }
+        }
+
+        static void disable(const std::size_t irq) noexcept {
+          if(irq < Table::size()){
+            disabled_bits[irq / word_bits].fetch_or(bit(irq), std::memory_order_release);
+          }
+        }
+
+        static bool is_pending(const std::size_t irq) noexcept {
+          return irq < Table::size() && (pending_bits[irq / word_bits].load(std::memory_order_acquire) & bit(irq)) != 0;
+        }
+        /**
+         * @brief Runs the pending and enabled interrupt handlers, until no enabled interrupt is pending.
+         * @return Number of handlers run.
+         */
+        static std::size_t dispatch() noexcept {
+          if(core.test_and_set(std::memory_order_acquire)){
+            return 0;
+          }
+
+          std::size_t count = 0;
+          for(std::size_t word = 0; word < word_count; ){
+            const auto ready = pending_bits[word].load(std::memory_order_acquire) & ~disabled_bits[word].load(std::memory_order_acquire);
+            if(ready == 0){
+              ++word;
+              continue;
+            }
+            const auto mask = ready & (~ready + 1);
+            pending_bits[word].fetch_and(~mask, std::memory_order_acq_rel);
+            Table::vectors[word * word_bits + static_cast<std::size_t>(std::countr_zero(mask))]();
+            ++count;
+            word = 0;
+          }
+
+          core.clear(std::memory_order_release);
+          return count;
+        }
+
+      private:
+        static inline std::array<std::atomic<word_type>, word_count> pending_bits { };
+        static inline std::array<std::atomic<word_type>, word_count> disabled_bits { };
+        static inline std::atomic_flag core { };
+    };
+}
+
+#endif //EMBEDDED_TL_EMBEDDED_INTERRUPT_HPP
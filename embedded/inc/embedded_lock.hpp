@@ -0,0 +1,201 @@
+/**
+ * @file embedded_lock.hpp
+ * @date 2024-10-14
+ * @author Robert Morley
+ *
+ * @brief Embedded Template Library : Register critical section (lock) policies header file.
+ *
+ * @version v0.1.0
+ * @copyright Copyright (c) 2024
+ */
+#ifndef EMBEDDED_TL_EMBEDDED_LOCK_HPP
+#define EMBEDDED_TL_EMBEDDED_LOCK_HPP
+
+#include <atomic>
+#if defined(UNIT_TEST) || defined(_GLIBCXX_HAS_GTHREADS)
+#include <mutex>
+#endif
+
+#include <embedded_types.hpp>
+#include <embedded_concepts.hpp>
+
+namespace embtl::lock {
+
+#if !defined(__ARM_ARCH) || defined(UNIT_TEST)
+    namespace details {
+        /**
+         * @brief Host simulation of a global interrupt mask, used by the interrupt lock policies on the host build.
+         * @details
+         * Masking interrupts stops all other contexts on a single core target, on the host the other contexts are
+         * threads, so the mask is simulated with a global spin lock. Nested locks on the same thread only take the
+         * spin lock once. Not compiled for ARM target builds, the nesting depth is thread_local.
+         */
+        struct host_interrupt_mask final {
+          public:
+            /**
+             * @brief Masks interrupts.
+             * @return true := interrupts were already masked by this thread; false := interrupts were not masked.
+             */
+            static bool mask() noexcept {
+              if(depth++ != 0){
+                return true;
+              }
+              while(flag.test_and_set(std::memory_order_acquire)){ }
+              return false;
+            }
+            /**
+             * @brief Restores the interrupt mask state returned by mask().
+             * @param masked [in] Interrupt mask state before mask() was called.
+             */
+            static void restore(const bool masked) noexcept {
+              --depth;
+              if(!masked){
+                flag.clear(std::memory_order_release);
+              }
+            }
+            /**
+             * @brief Checks if interrupts are masked by this thread.
+             * @return true := interrupts masked; false := interrupts not masked.
+             */
+            static bool is_masked() noexcept { return depth != 0; }
+
+          private:
+            inline static std::atomic_flag flag { };
+            inline static thread_local std::size_t depth { 0 };
+        };
+    }
+#endif
+
+    /**
+     * @brief Lock policy : no lock, the read-modify-write is not protected.
+     */
+    struct no_lock final {
+      public:
+        using state_type = bool;
+
+        static constexpr state_type lock() noexcept { return false; }
+        static constexpr void unlock([[maybe_unused]] const state_type state) noexcept { }
+    };
+    static_assert(register_lock_policy<no_lock>);
+
+    /**
+     * @brief Lock policy : PRIMASK save/restore, masks all configurable priority interrupts.
+     * @note On the host build the interrupt mask is simulated with a global lock.
+     */
+    struct primask_lock final {
+      public:
+#if defined(__ARM_ARCH) && !defined(UNIT_TEST)
+        using state_type = std::uint32_t;
+        /**
+         * @brief Saves PRIMASK and disables interrupts.
+         * @return PRIMASK value before interrupts were disabled.
+         */
+        static state_type lock() noexcept {
+          state_type primask;
+          asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) : : "memory");
+          return primask;
+        }
+        /**
+         * @brief Restores PRIMASK.
+         * @param state [in] PRIMASK value returned by lock().
+         */
+        static void unlock(const state_type state) noexcept {
+          asm volatile ("msr primask, %0" : : "r" (state) : "memory");
+        }
+#else
+        using state_type = bool;
+
+        static state_type lock() noexcept { return details::host_interrupt_mask::mask(); }
+        static void unlock(const state_type state) noexcept { details::host_interrupt_mask::restore(state); }
+#endif
+    };
+    static_assert(register_lock_policy<primask_lock>);
+
+    /**
+     * @brief Lock policy : BASEPRI save/raise/restore, masks interrupts with a priority value at or above Level.
+     * @tparam Level BASEPRI priority level, already shifted to the implemented priority bits. Must not be 0.
+     * @note Requires ARMv7-M or ARMv8-M mainline. On the host build the interrupt mask is simulated with a global lock.
+     */
+    template<std::uint8_t Level>
+    requires (Level != 0)
+    struct basepri_lock final {
+      public:
+#if defined(__ARM_ARCH) && !defined(UNIT_TEST)
+        using state_type = std::uint32_t;
+        /**
+         * @brief Saves BASEPRI and raises it to Level, a lower BASEPRI is never raised.
+         * @return BASEPRI value before it was raised.
+         */
+        static state_type lock() noexcept {
+          state_type basepri;
+          asm volatile ("mrs %0, basepri\n\tmsr basepri_max, %1" : "=&r" (basepri) : "r" (std::uint32_t { Level }) : "memory");
+          return basepri;
+        }
+        /**
+         * @brief Restores BASEPRI.
+         * @param state [in] BASEPRI value returned by lock().
+         */
+        static void unlock(const state_type state) noexcept {
+          asm volatile ("msr basepri, %0" : : "r" (state) : "memory");
+        }
+#else
+        using state_type = bool;
+
+        static state_type lock() noexcept { return details::host_interrupt_mask::mask(); }
+        static void unlock(const state_type state) noexcept { details::host_interrupt_mask::restore(state); }
+#endif
+    };
+    static_assert(register_lock_policy<basepri_lock<0x80>>);
+
+    /**
+     * @brief Lock policy : spin lock, one lock per Tag type.
+     * @tparam Tag Lock tag type, registers with the same Tag share the lock. (default = void)
+     * @note Must not be used between an interrupt and the thread it interrupted on a single core, the interrupt would
+     *       spin forever.
+     */
+    template<typename Tag = void>
+    struct spin_lock final {
+      public:
+        using state_type = bool;
+
+        static state_type lock() noexcept {
+          while(flag.test_and_set(std::memory_order_acquire)){ }
+          return true;
+        }
+        static void unlock([[maybe_unused]] const state_type state) noexcept {
+          flag.clear(std::memory_order_release);
+        }
+
+      private:
+        inline static std::atomic_flag flag { };
+    };
+    static_assert(register_lock_policy<spin_lock<>>);
+
+#if defined(UNIT_TEST) || defined(_GLIBCXX_HAS_GTHREADS)
+    /**
+     * @brief Lock policy : std::mutex, one mutex per Tag type.
+     * @tparam Tag Lock tag type, registers with the same Tag share the mutex. (default = void)
+     * @note For RTOS or host builds, must not be used in interrupt context. Only available in unit test builds and with a
+     *       threaded standard library (gthreads), bare metal toolchains do not provide std::mutex.
+     */
+    template<typename Tag = void>
+    struct mutex_lock final {
+      public:
+        using state_type = bool;
+
+        static state_type lock() noexcept {
+          mutex.lock();
+          return true;
+        }
+        static void unlock([[maybe_unused]] const state_type state) noexcept {
+          mutex.unlock();
+        }
+
+      private:
+        inline static std::mutex mutex { };
+    };
+    static_assert(register_lock_policy<mutex_lock<>>);
+#endif
+}
+
+#endif //EMBEDDED_TL_EMBEDDED_LOCK_HPP
@@ -11,9 +11,12 @@
 #ifndef EMBEDDED_TL_EMBEDDED_POLICY_HPP
 #define EMBEDDED_TL_EMBEDDED_POLICY_HPP
 
+#include <array>
+
 #include <embedded_types.hpp>
 #include <embedded_bits.hpp>
 #include <embedded_concepts.hpp>
+#include <embedded_lock.hpp>
 
 namespace embtl::policy {
 
@@ -58,7 +61,7 @@ namespace embtl::policy {
           // Read register before side effect.
           auto reg_value = reg;
           // Implement side effect if template parameter SideEffect meets requirements
-          if constexpr (mmio_side_effect_read_only<side_effect>){
+          if constexpr (mmio_side_effect_read_only<side_effect, value_type>){
             side_effect::read(reg);
           }
           // Return read value.
@@ -73,7 +76,7 @@ namespace embtl::policy {
         static value_type read(volatile value_type& reg) noexcept
         requires (EffectBefore){
           // Implement side effect if template parameter SideEffect meets requirements
-          if constexpr (mmio_side_effect_read_only<side_effect>){
+          if constexpr (mmio_side_effect_read_only<side_effect, value_type>){
             side_effect::read(reg);
           }
           return reg; // Return Register value after side effect.
@@ -109,7 +112,7 @@ namespace embtl::policy {
      * @note Side effects are only executed when the type provided meets the requirements of the mmio_side_effect_write_only
      *       concept.
      */
-    template<embedded_base_type Base, Base Mask = std::numeric_limits<arch_type>::max(), typename SideEffect = void>
+    template<embedded_base_type Base, Base Mask = std::numeric_limits<Base>::max(), typename SideEffect = void>
     struct basic_reg_write_only : public basic_reg_root<Base> {
       public:
         using value_type = Base;
@@ -121,7 +124,7 @@ namespace embtl::policy {
          * @param val [in] Value to be written to register.
 //         */
         static void write(volatile value_type& reg, const value_type value) noexcept {
-          if constexpr (mmio_side_effect_write_only<side_effect>){
+          if constexpr (mmio_side_effect_write_only<side_effect, value_type>){
             side_effect::write(reg, value & Mask);
           } else {
             reg = value & Mask;
@@ -135,18 +138,25 @@ namespace embtl::policy {
      * @tparam Base Register value type.
      * @tparam Mask Write bit mask for register.
      * @tparam SideEffect Used for unit testing, simulates the effects of read/write access to the register.
+     * @tparam RdEffectBefore true := Read side effect executes before register read; false := after register read.
+     * @tparam Lock Lock policy held for the read-modify-write of the register, see embtl::lock. (default = no_lock)
      *
      * @note Side effects are only executed when the type provided meets the requirements of the mmio_side_effect_read_write
      *       concept.
+     * @note With a Lock policy other than no_lock the policy also provides set_bits(), clear_bits(), toggle_bits() and
+     *       modify(), so the set<>(), clear<>(), modify() methods and the &=, |=, ^= operators of basic_hardware_register
+     *       hold the lock only for the read-modify-write of the register.
      */
-    template<embedded_base_type Base, Base Mask = std::numeric_limits<Base>::max(), typename SideEffect = void, bool RdEffectBefore = false>
+    template<embedded_base_type Base, Base Mask = std::numeric_limits<Base>::max(), typename SideEffect = void,
+             bool RdEffectBefore = false, register_lock_policy Lock = lock::no_lock>
     struct basic_reg_read_write : public basic_reg_read_only<Base, SideEffect, RdEffectBefore>, basic_reg_write_only<Base, Mask, SideEffect> {
       public:
         using value_type = Base;
         using reg_base = basic_reg_root<Base>;
-        using reg_ro = basic_reg_read_only<Base, SideEffect>;
+        using reg_ro = basic_reg_read_only<Base, SideEffect, RdEffectBefore>;
         using reg_wo = basic_reg_write_only<Base, Mask, SideEffect>;
         using side_effect = SideEffect;
+        using lock_type = Lock;
         /**
          * @brief Write-only policy : Set bit field method.
          * @tparam Mask Write mask for register.
@@ -159,20 +169,20 @@ namespace embtl::policy {
                               const std::size_t pos, const std::size_t size,
                               const value_type value,
                               bool shifted = false) noexcept{
-          // Read register
-          auto reg_v =reg_ro::read(reg);
-          // Clear field
-          reg_v &= ~reg_base::make_mask(pos, size);
           // Set field value
           auto field_mask = reg_base::make_mask(shifted ? pos : 0, size);
+          auto field_value = shifted ? static_cast<value_type>(value & field_mask)
+                                     : static_cast<value_type>((value & field_mask) << pos);
 
-          if(shifted){
-            reg_v |= value & field_mask;
-          } else {
-            reg_v |= (value & field_mask) << pos;
-          }
+          const auto state = lock_type::lock();
+          // Read register
+          auto reg_v = reg_ro::read(reg);
+          // Clear field
+          reg_v = static_cast<value_type>(reg_v & ~reg_base::make_mask(pos, size));
+          reg_v |= field_value;
           // Write back to register.
           reg_wo::write(reg, reg_v);
+          lock_type::unlock(state);
         }
         /**
          * @brief Write-only policy : Clear bit field.
@@ -183,17 +193,551 @@ namespace embtl::policy {
          */
         static void clear_field(volatile value_type& reg,
                                 const std::size_t pos, const std::size_t size) noexcept {
+          const auto state = lock_type::lock();
           // Read Register
           auto reg_v = reg_ro::read(reg);
           // Clear field
-          reg_v &= ~reg_base::make_mask(pos, size);
+          reg_v = static_cast<value_type>(reg_v & ~reg_base::make_mask(pos, size));
           // Write Register
           reg_wo::write(reg, reg_v);
+          lock_type::unlock(state);
+        }
+        /**
+         * @brief Locked policy : Replaces the bits in clear_mask with set_value, read-modify-write holding the lock.
+         * @param reg [in] Reference to device register.
+         * @param clear_mask [in] Bits to be cleared.
+         * @param set_value [in] Bits to be set.
+         * @note Only available if Lock is not no_lock.
+         */
+        static void modify(volatile value_type& reg, const value_type clear_mask, const value_type set_value) noexcept
+        requires (!std::same_as<lock_type, lock::no_lock>) {
+          const auto state = lock_type::lock();
+          reg_wo::write(reg, static_cast<value_type>((reg_ro::read(reg) & ~clear_mask) | set_value));
+          lock_type::unlock(state);
+        }
+        /**
+         * @brief Locked policy : Set bits method.
+         * @param reg [in] Reference to device register.
+         * @param bits [in] Bits to be set.
+         * @note Only available if Lock is not no_lock.
+         */
+        static void set_bits(volatile value_type& reg, const value_type bits) noexcept
+        requires (!std::same_as<lock_type, lock::no_lock>) {
+          modify(reg, 0, bits);
+        }
+        /**
+         * @brief Locked policy : Clear bits method.
+         * @param reg [in] Reference to device register.
+         * @param bits [in] Bits to be cleared.
+         * @note Only available if Lock is not no_lock.
+         */
+        static void clear_bits(volatile value_type& reg, const value_type bits) noexcept
+        requires (!std::same_as<lock_type, lock::no_lock>) {
+          modify(reg, bits, 0);
+        }
+        /**
+         * @brief Locked policy : Toggle bits method.
+         * @param reg [in] Reference to device register.
+         * @param bits [in] Bits to be toggled.
+         * @note Only available if Lock is not no_lock.
+         */
+        static void toggle_bits(volatile value_type& reg, const value_type bits) noexcept
+        requires (!std::same_as<lock_type, lock::no_lock>) {
+          const auto state = lock_type::lock();
+          reg_wo::write(reg, static_cast<value_type>(reg_ro::read(reg) ^ bits));
+          lock_type::unlock(state);
         }
     };
     static_assert(mmio_register_policy_write_only<basic_reg_read_write<arch_type>>);
     static_assert(mmio_register_policy_read_only<basic_reg_read_write<arch_type>>);
     static_assert(mmio_register_policy_read_write<basic_reg_read_write<arch_type>>);
+    static_assert(!mmio_register_policy_atomic_bits<basic_reg_read_write<arch_type>>);
+    static_assert(mmio_register_policy_atomic_modify<basic_reg_read_write<arch_type, std::numeric_limits<arch_type>::max(), void, false, lock::primask_lock>>);
+
+    /**
+     * @brief Register policy : read/write with atomic SET/CLR/XOR alias registers template.
+     * @tparam Base Register value type.
+     * @tparam SetOffset Byte offset from the register address to the bit set alias.
+     * @tparam ClrOffset Byte offset from the register address to the bit clear alias.
+     * @tparam XorOffset Byte offset from the register address to the bit toggle alias.
+     * @tparam Mask Write bit mask for register.
+     * @tparam SideEffect Used for unit testing, simulates the effects of read/write access to the register.
+     * @tparam Simulate true := alias writes are simulated with a read/write of the register (host builds);
+     *                  false := alias writes are stores to the alias addresses. Default is host_allocation::value.
+     *
+     * @details
+     * Many microcontrollers have SET, CLR and XOR alias addresses at fixed offsets from a register, a write to an alias
+     * sets, clears or toggles the bits written without a read-modify-write of the register. With this policy the
+     * set_field(), clear_field(), set<>(), clear<>(), modify() methods and the &=, |= and ^= operators of the
+     * basic_hardware_register are alias stores, they cannot be interrupted between a read and a write.
+     *
+     * @note set_field() with a multi-bit value is a clear alias store followed by a set alias store, the field can be
+     *       seen with the value bits partly written between the two stores.
+     */
+    template<embedded_base_type Base, std::size_t SetOffset, std::size_t ClrOffset, std::size_t XorOffset,
+             Base Mask = std::numeric_limits<Base>::max(), typename SideEffect = void, bool Simulate = host_allocation::value>
+    struct basic_reg_read_write_aliased : public basic_reg_read_write<Base, Mask, SideEffect> {
+      public:
+        using value_type = Base;
+        using reg_base = basic_reg_root<Base>;
+        using reg_ro = basic_reg_read_only<Base, SideEffect>;
+        using reg_wo = basic_reg_write_only<Base, Mask, SideEffect>;
+        using side_effect = SideEffect;
+        /**
+         * @brief Aliased policy : Set bits method, single store to the set alias.
+         * @param reg [in] Reference to device register.
+         * @param bits [in] Bits to be set.
+         */
+        static void set_bits(volatile value_type& reg, const value_type bits) noexcept {
+          if constexpr (Simulate){
+            reg_wo::write(reg, static_cast<value_type>(reg_ro::read(reg) | (bits & Mask)));
+          } else {
+            alias<SetOffset>(reg) = static_cast<value_type>(bits & Mask);
+          }
+        }
+        /**
+         * @brief Aliased policy : Clear bits method, single store to the clear alias.
+         * @param reg [in] Reference to device register.
+         * @param bits [in] Bits to be cleared.
+         */
+        static void clear_bits(volatile value_type& reg, const value_type bits) noexcept {
+          if constexpr (Simulate){
+            reg_wo::write(reg, static_cast<value_type>(reg_ro::read(reg) & ~(bits & Mask)));
+          } else {
+            alias<ClrOffset>(reg) = static_cast<value_type>(bits & Mask);
+          }
+        }
+        /**
+         * @brief Aliased policy : Toggle bits method, single store to the xor alias.
+         * @param reg [in] Reference to device register.
+         * @param bits [in] Bits to be toggled.
+         */
+        static void toggle_bits(volatile value_type& reg, const value_type bits) noexcept {
+          if constexpr (Simulate){
+            reg_wo::write(reg, static_cast<value_type>(reg_ro::read(reg) ^ (bits & Mask)));
+          } else {
+            alias<XorOffset>(reg) = static_cast<value_type>(bits & Mask);
+          }
+        }
+        /**
+         * @brief Aliased policy : Set bit field method, the register is not read.
+         * @param reg [in] Reference to device register.
+         * @param pos [in] Starting bit position of the field.
+         * @param size [in] Size of the field in bits.
+         * @param value [in] Value to be written to the field.
+         * @param shifted [in] true := value already shifted to the field position. false (default) := value not shifted.
+         */
+        static void set_field(volatile value_type& reg,
+                              const std::size_t pos, const std::size_t size,
+                              const value_type value,
+                              bool shifted = false) noexcept {
+          const auto field_mask = reg_base::make_mask(pos, size);
+          const auto bits = shifted ? static_cast<value_type>(value & field_mask)
+                                    : static_cast<value_type>((value & reg_base::make_mask(0, size)) << pos);
+          const auto clear_value = static_cast<value_type>(field_mask & ~bits);
+
+          if(clear_value != 0){
+            clear_bits(reg, clear_value);
+          }
+          if(bits != 0){
+            set_bits(reg, bits);
+          }
+        }
+        /**
+         * @brief Aliased policy : Clear bit field method, single store to the clear alias.
+         * @param reg [in] Reference to device register.
+         * @param pos [in] Starting bit position of the field.
+         * @param size [in] Size of the field in bits.
+         */
+        static void clear_field(volatile value_type& reg,
+                                const std::size_t pos, const std::size_t size) noexcept {
+          clear_bits(reg, reg_base::make_mask(pos, size));
+        }
+
+      private:
+        /**
+         * @brief Alias register of reg at Offset bytes.
+         * @tparam Offset Byte offset of the alias register.
+         * @param reg [in] Reference to device register.
+         * @return Reference to the alias register.
+         */
+        template<std::size_t Offset>
+        static volatile value_type& alias(volatile value_type& reg) noexcept {
+          return *reinterpret_cast<volatile value_type*>(reinterpret_cast<std::uintptr_t>(&reg) + Offset);
+        }
+    };
+    static_assert(mmio_register_policy_atomic_bits<basic_reg_read_write_aliased<arch_type, 0x1000, 0x2000, 0x3000>>);
+
+    /**
+     * @brief Register policy : read/write with lock-free atomic read-modify-write template.
+     * @tparam Base Register value type.
+     * @tparam Mask Write bit mask for register.
+     *
+     * @details
+     * Read-modify-write accesses use the GCC/Clang __atomic builtins on the volatile register, fetch_or/fetch_and/fetch_xor
+     * for the bit methods and a compare-exchange loop for field updates (LDREX/STREX on Cortex-M3 and above, lock prefixed
+     * instructions on x86). The builtins take the volatile pointer, every access stays a volatile access.
+     * Registers and shared flags updated from interrupt and thread context keep all concurrent updates without
+     * disabling interrupts. With this policy the set_field(), clear_field(), set<>(), clear<>(), modify() methods and
+     * the &=, |= and ^= operators of basic_hardware_register are atomic.
+     *
+     * @note Base must be always lock-free, ex: not available on Cortex-M0, see basic_reg_read_write with a Lock policy.
+     *       Side effects are not supported.
+     */
+    template<embedded_base_type Base, Base Mask = std::numeric_limits<Base>::max()>
+    struct basic_reg_read_write_atomic : public basic_reg_root<Base> {
+      public:
+        using value_type = Base;
+        using reg_base = basic_reg_root<Base>;
+        using side_effect = void;
+
+        static_assert(__atomic_always_lock_free(sizeof(value_type), 0), "Register value type is not lock-free.");
+        /**
+         * @brief Atomic policy : Read method.
+         * @param reg [in] Reference to device register.
+         * @return Value of the register.
+         */
+        static value_type read(volatile value_type& reg) noexcept {
+          return __atomic_load_n(&reg, __ATOMIC_ACQUIRE);
+        }
+        /**
+         * @brief Atomic policy : get bit field.
+         * @param reg [in] Reference to device register.
+         * @param pos [in] Starting bit position of the field.
+         * @param size [in] Size in bits of the field.
+         * @param shifted [in] true (default) := Field value shifted to bit 0. false := Masked field value.
+         * @return Field data.
+         */
+        static value_type get_field(volatile value_type& reg, std::size_t pos, std::size_t size, bool shifted = true) noexcept {
+          auto value = static_cast<value_type>(read(reg) & reg_base::make_mask(pos, size));
+          return shifted ? static_cast<value_type>(value >> pos) : value;
+        }
+        /**
+         * @brief Atomic policy : Write method.
+         * @param reg [in] Reference to device register.
+         * @param value [in] Value to be written to register.
+         */
+        static void write(volatile value_type& reg, const value_type value) noexcept {
+          __atomic_store_n(&reg, static_cast<value_type>(value & Mask), __ATOMIC_RELEASE);
+        }
+        /**
+         * @brief Atomic policy : Set bits method.
+         * @param reg [in] Reference to device register.
+         * @param bits [in] Bits to be set.
+         */
+        static void set_bits(volatile value_type& reg, const value_type bits) noexcept {
+          __atomic_fetch_or(&reg, static_cast<value_type>(bits & Mask), __ATOMIC_ACQ_REL);
+        }
+        /**
+         * @brief Atomic policy : Clear bits method.
+         * @param reg [in] Reference to device register.
+         * @param bits [in] Bits to be cleared.
+         */
+        static void clear_bits(volatile value_type& reg, const value_type bits) noexcept {
+          __atomic_fetch_and(&reg, static_cast<value_type>(~(bits & Mask)), __ATOMIC_ACQ_REL);
+        }
+        /**
+         * @brief Atomic policy : Toggle bits method.
+         * @param reg [in] Reference to device register.
+         * @param bits [in] Bits to be toggled.
+         */
+        static void toggle_bits(volatile value_type& reg, const value_type bits) noexcept {
+          __atomic_fetch_xor(&reg, static_cast<value_type>(bits & Mask), __ATOMIC_ACQ_REL);
+        }
+        /**
+         * @brief Atomic policy : Replaces the bits in clear_mask with set_value, compare-exchange loop.
+         * @param reg [in] Reference to device register.
+         * @param clear_mask [in] Bits to be cleared.
+         * @param set_value [in] Bits to be set.
+         */
+        static void modify(volatile value_type& reg, const value_type clear_mask, const value_type set_value) noexcept {
+          value_type expected = __atomic_load_n(&reg, __ATOMIC_RELAXED);
+          value_type desired;
+
+          do {
+            desired = static_cast<value_type>((expected & ~(clear_mask & Mask)) | (set_value & Mask));
+          } while(!__atomic_compare_exchange_n(&reg, &expected, desired, true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+        }
+        /**
+         * @brief Atomic policy : Set bit field method.
+         * @param reg [in] Reference to device register.
+         * @param pos [in] Starting bit position of the field.
+         * @param size [in] Size of the field in bits.
+         * @param value [in] Value to be written to the field.
+         * @param shifted [in] true := value already shifted to the field position. false (default) := value not shifted.
+         */
+        static void set_field(volatile value_type& reg,
+                              const std::size_t pos, const std::size_t size,
+                              const value_type value,
+                              bool shifted = false) noexcept {
+          const auto field_mask = reg_base::make_mask(pos, size);
+          const auto bits = shifted ? static_cast<value_type>(value & field_mask)
+                                    : static_cast<value_type>((value & reg_base::make_mask(0, size)) << pos);
+          modify(reg, field_mask, bits);
+        }
+        /**
+         * @brief Atomic policy : Clear bit field method.
+         * @param reg [in] Reference to device register.
+         * @param pos [in] Starting bit position of the field.
+         * @param size [in] Size of the field in bits.
+         */
+        static void clear_field(volatile value_type& reg,
+                                const std::size_t pos, const std::size_t size) noexcept {
+          clear_bits(reg, reg_base::make_mask(pos, size));
+        }
+    };
+#if defined(__GCC_ATOMIC_INT_LOCK_FREE) && __GCC_ATOMIC_INT_LOCK_FREE == 2
+    static_assert(mmio_register_policy_atomic_modify<basic_reg_read_write_atomic<arch_type>>);
+#endif
+
+    /**
+     * @brief Register policy : write-only with shadow copy template.
+     * @tparam Base Register value type.
+     * @tparam Mask Write bit mask for register.
+     * @tparam Reset Register reset value, initial value of each shadow copy and default Reset of basic_hardware_register.
+     * @tparam Instances Number of registers using this policy type, ex: 3 for the CR of UART1..3 in one register map.
+     * @tparam SideEffect Used for unit testing, simulates the effects of write access to the register.
+     *
+     * @details
+     * Write-only register policy that keeps a non-volatile shadow copy of the last value written to the register. Reads
+     * and the read part of bit field updates use the shadow copy and never access the register, each write is a single
+     * store to the register. The policy satisfies the read/write policy concepts, so set_field(), clear_field() and the
+     * compound assignment operators of basic_hardware_register are available for write-only registers.
+     *
+     * The shadow copies are kept per register address in a table of Instances slots, a slot is claimed (interrupts
+     * masked) by the first access to a register. Registers of several devices allocated from one register map each have
+     * their own copy. A register accessed once the table is full is not tracked: read() returns the Reset value and a
+     * field update starts from it.
+     *
+     * @note Shadow copy updates are not atomic, a field update of the same register from an interrupt handler needs a
+     *       lock around the update.
+     */
+    template<embedded_base_type Base, Base Mask = std::numeric_limits<Base>::max(),
+             Base Reset = std::numeric_limits<Base>::min(), std::size_t Instances = 1, typename SideEffect = void>
+    requires (Instances > 0)
+    struct basic_reg_write_only_shadowed : public basic_reg_write_only<Base, Mask, SideEffect> {
+      public:
+        using value_type = Base;
+        using reg_base = basic_reg_root<Base>;
+        using reg_wo = basic_reg_write_only<Base, Mask, SideEffect>;
+        using side_effect = SideEffect;
+
+        static constexpr value_type reset_value = Reset;
+        /**
+         * @brief Shadowed policy : Read method, register is not accessed.
+         * @param reg [in] Reference to device register, selects the shadow copy.
+         * @return Value of the shadow copy.
+         */
+        static value_type read(volatile value_type& reg) noexcept {
+          const auto* copy = find(reg);
+          return copy != nullptr ? *copy : initial;
+        }
+        /**
+         * @brief Shadowed policy : get bit field, register is not accessed.
+         * @param reg [in] Reference to device register, selects the shadow copy.
+         * @param pos [in] Starting bit position of the field.
+         * @param size [in] Size in bits of the field.
+         * @param shifted [in] true (default) := Field value shifted to bit 0. false := Masked field value.
+         * @return Field data from the shadow copy.
+         */
+        static value_type get_field(volatile value_type& reg, std::size_t pos, std::size_t size, bool shifted = true) noexcept {
+          auto value = static_cast<value_type>(read(reg) & reg_base::make_mask(pos, size));
+          return shifted ? static_cast<value_type>(value >> pos) : value;
+        }
+        /**
+         * @brief Shadowed policy : Write method, updates shadow copy and writes register.
+         * @param reg [in] Reference to device register.
+         * @param value [in] Value to be written to register.
+         */
+        static void write(volatile value_type& reg, const value_type value) noexcept {
+          const auto masked = static_cast<value_type>(value & Mask);
+          if(auto* copy = claim(reg); copy != nullptr){
+            *copy = masked;
+          }
+          reg_wo::write(reg, masked);
+        }
+        /**
+         * @brief Shadowed policy : Set bit field method, single register write.
+         * @param reg [in] Reference to device register.
+         * @param pos [in] Starting bit position of the field.
+         * @param size [in] Size of the field in bits.
+         * @param value [in] Value to be written to the field.
+         * @param shifted [in] true := value already shifted to the field position. false (default) := value not shifted.
+         */
+        static void set_field(volatile value_type& reg,
+                              const std::size_t pos, const std::size_t size,
+                              const value_type value,
+                              bool shifted = false) noexcept {
+          auto reg_v = static_cast<value_type>(read(reg) & ~reg_base::make_mask(pos, size));
+          auto field_mask = reg_base::make_mask(shifted ? pos : 0, size);
+
+          if(shifted){
+            reg_v |= value & field_mask;
+          } else {
+            reg_v |= static_cast<value_type>((value & field_mask) << pos);
+          }
+
+          write(reg, reg_v);
+        }
+        /**
+         * @brief Shadowed policy : Clear bit field method, single register write.
+         * @param reg [in] Reference to device register.
+         * @param pos [in] Starting bit position of the field.
+         * @param size [in] Size of the field in bits.
+         */
+        static void clear_field(volatile value_type& reg,
+                                const std::size_t pos, const std::size_t size) noexcept {
+          write(reg, static_cast<value_type>(read(reg) & ~reg_base::make_mask(pos, size)));
+        }
+
+      private:
+        struct shadow_slot {
+            volatile value_type* reg;
+            value_type value;
+        };
+
+        static constexpr value_type initial = static_cast<value_type>(Reset & Mask);
+
+        static value_type* find(volatile value_type& reg) noexcept {
+          for(auto& slot : shadows){
+            if(slot.reg == &reg){
+              return &slot.value;
+            }
+          }
+          return nullptr;
+        }
+
+        static value_type* claim(volatile value_type& reg) noexcept {
+          if(auto* copy = find(reg); copy != nullptr){
+            return copy;
+          }
+          const auto state = lock::primask_lock::lock();
+          value_type* copy = find(reg);
+          for(std::size_t i = 0; copy == nullptr && i < Instances; ++i){
+            if(shadows[i].reg == nullptr){
+              shadows[i] = { &reg, initial };
+              copy = &shadows[i].value;
+            }
+          }
+          lock::primask_lock::unlock(state);
+          return copy;
+        }
+
+        inline static std::array<shadow_slot, Instances> shadows { };
+    };
+    static_assert(mmio_register_policy_write_only<basic_reg_write_only_shadowed<arch_type>>);
+    static_assert(mmio_register_policy_read_write<basic_reg_write_only_shadowed<arch_type>>);
+
+    /**
+     * @brief Register policy : read with write-one-to-clear (W1C) template.
+     * @tparam Base Register value type.
+     * @tparam Mask Write bit mask for register, bits that can be cleared.
+     * @tparam SideEffect Used for unit testing, simulates the effects of read/write access to the register.
+     * @tparam Simulate true := writes clear the bits written in the register (host builds); false := writes are stores
+     *                  to the register. Default is host_allocation::value.
+     *
+     * @details
+     * Status registers where writing 1 to a bit clears it and writing 0 has no effect. clear_bits() and clear_field()
+     * are a single store of the bits to be cleared, the register is not read so other pending flags are not cleared.
+     * The policy does not meet the read/write policy concept, the read-modify-write methods and operators of
+     * basic_hardware_register are not available.
+     */
+    template<embedded_base_type Base, Base Mask = std::numeric_limits<Base>::max(), typename SideEffect = void,
+             bool Simulate = host_allocation::value>
+    struct basic_reg_write_1_clear : public basic_reg_read_only<Base, SideEffect> {
+      public:
+        using value_type = Base;
+        using reg_base = basic_reg_root<Base>;
+        using side_effect = SideEffect;
+        /**
+         * @brief W1C policy : Write method, bits written as 1 are cleared.
+         * @param reg [in] Reference to device register.
+         * @param value [in] Bits to be cleared.
+         */
+        static void write(volatile value_type& reg, const value_type value) noexcept {
+          const auto bits = static_cast<value_type>(value & Mask);
+
+          if constexpr (mmio_side_effect_write_only<side_effect, value_type>){
+            side_effect::write(reg, bits);
+          } else if constexpr (Simulate){
+            reg = static_cast<value_type>(reg & ~bits);
+          } else {
+            reg = bits;
+          }
+        }
+        /**
+         * @brief W1C policy : Clear bits method, single store.
+         * @param reg [in] Reference to device register.
+         * @param bits [in] Bits to be cleared.
+         */
+        static void clear_bits(volatile value_type& reg, const value_type bits) noexcept {
+          write(reg, bits);
+        }
+        /**
+         * @brief W1C policy : Clear bit field method, single store.
+         * @param reg [in] Reference to device register.
+         * @param pos [in] Starting bit position of the field.
+         * @param size [in] Size of the field in bits.
+         */
+        static void clear_field(volatile value_type& reg,
+                                const std::size_t pos, const std::size_t size) noexcept {
+          write(reg, reg_base::make_mask(pos, size));
+        }
+    };
+    static_assert(mmio_register_policy_write_1_clear<basic_reg_write_1_clear<arch_type>>);
+    /**
+     * @brief Register policy : read-to-clear (R2C) template.
+     * @tparam Base Register value type.
+     * @tparam SideEffect Used for unit testing, simulates the effects of read access to the register.
+     * @tparam Simulate true := reads clear the register (host builds); false := register is cleared by the device.
+     *                  Default is host_allocation::value.
+     *
+     * @details
+     * Status registers that are cleared by the device when read. Each read() or get_field() returns the flags and
+     * clears the register, clear() acknowledges all flags with a single read. The policy has no write access.
+     */
+    template<embedded_base_type Base, typename SideEffect = void, bool Simulate = host_allocation::value>
+    struct basic_reg_read_clear : public basic_reg_root<Base> {
+      public:
+        using value_type = Base;
+        using reg_base = basic_reg_root<Base>;
+        using side_effect = SideEffect;
+        /**
+         * @brief R2C policy : Read method, the register is cleared by the read.
+         * @param reg [in] Reference to device register.
+         * @return Value of the register before it was cleared.
+         */
+        static value_type read(volatile value_type& reg) noexcept {
+          const value_type reg_value = reg;
+
+          if constexpr (mmio_side_effect_read_only<side_effect, value_type>){
+            side_effect::read(reg);
+          } else if constexpr (Simulate){
+            reg = 0;
+          }
+          return reg_value;
+        }
+        /**
+         * @brief R2C policy : get bit field, the register is cleared by the read.
+         * @param reg [in] Reference to device register.
+         * @param pos [in] Starting bit position of the field.
+         * @param size [in] Size in bits of the field.
+         * @param shifted [in] true (default) := Field value shifted to bit 0. false := Masked field value.
+         * @return Field data.
+         */
+        static value_type get_field(volatile value_type& reg, std::size_t pos, std::size_t size, bool shifted = true) noexcept {
+          auto value = static_cast<value_type>(read(reg) & reg_base::make_mask(pos, size));
+          return shifted ? static_cast<value_type>(value >> pos) : value;
+        }
+        /**
+         * @brief R2C policy : Clear method, single read of the register.
+         * @param reg [in] Reference to device register.
+         */
+        static void clear(volatile value_type& reg) noexcept {
+          static_cast<void>(read(reg));
+        }
+    };
+    static_assert(mmio_register_policy_read_clear<basic_reg_read_clear<arch_type>>);
 
     template<embedded_base_type Base>
     struct basic_reg_reserved {
@@ -203,6 +747,16 @@ namespace embtl::policy {
 
     template<typename Policy>
     using policy_side_effect_t = typename Policy::side_effect;
+
+    /**
+     * @brief Register reset value of a policy, Policy::reset_value if the policy has one, otherwise the Base minimum.
+     */
+    template<typename Policy, embedded_base_type Base>
+    inline constexpr Base policy_reset_v = std::numeric_limits<Base>::min();
+
+    template<typename Policy, embedded_base_type Base>
+    requires requires { Policy::reset_value; }
+    inline constexpr Base policy_reset_v<Policy, Base> = static_cast<Base>(Policy::reset_value);
 }
 
 #endif //EMBEDDED_TL_EMBEDDED_POLICY_HPP
@@ -11,11 +11,238 @@
 #ifndef EMBEDDED_TL_EMBEDDED_REGION_HPP
 #define EMBEDDED_TL_EMBEDDED_REGION_HPP
 
+#include <cstddef>
+#include <cstring>
+#include <array>
+
 #include <embedded_concepts.hpp>
+#include <embedded_utilities.hpp>
 #include <embedded_register.hpp>
+#include <embedded_register_array.hpp>
 
 namespace embtl {
 
+    namespace details {
+        /**
+         * @brief Member object pointer traits.
+         * @tparam T Member object pointer type.
+         */
+        template<typename T>
+        struct member_pointer_traits;
+
+        template<typename Class, typename Member>
+        struct member_pointer_traits<Member Class::*> {
+            using class_type = Class;
+            using member_type = Member;
+        };
+        /**
+         * @brief Byte offset of a member in its class, measured on a zero initialized static instance of the class.
+         * @tparam Member Member object pointer.
+         * @note Only the address of the instance is used, the optimizer folds the offset to a constant and drops it.
+         */
+        template<auto Member>
+        std::size_t member_offset() noexcept {
+          using class_type = typename member_pointer_traits<decltype(Member)>::class_type;
+          static class_type probe;
+          return static_cast<std::size_t>(reinterpret_cast<const volatile std::byte*>(&(probe.*Member)) -
+                                          reinterpret_cast<const volatile std::byte*>(&probe));
+        }
+    }
+
+    /**
+     * @brief Checks if Member is a pointer to a register member of the RegisterMap class.
+     * @tparam Member Member object pointer, ex: &uart_register_map::CTRL.
+     * @tparam RegisterMap Register map class.
+     */
+    template<auto Member, typename RegisterMap>
+    concept register_map_member = std::is_member_object_pointer_v<decltype(Member)> &&
+            std::is_base_of_v<typename details::member_pointer_traits<decltype(Member)>::class_type, RegisterMap>;
+
+    /**
+     * @brief Register type of a register map member pointer.
+     * @tparam Member Member object pointer, ex: &uart_register_map::CTRL.
+     */
+    template<auto Member>
+    using register_member_t = typename details::member_pointer_traits<decltype(Member)>::member_type;
+
+
+    namespace details {
+        /**
+         * @brief Checks if T is a register array or register block array.
+         */
+        template<typename T>
+        struct is_strided_array : std::false_type { };
+
+        template<typename T, std::size_t N, std::size_t Stride>
+        struct is_strided_array<basic_strided_array<T, N, Stride>> : std::true_type { };
+        /**
+         * @brief Calls f with each register of a register map in declaration order, register blocks and register arrays
+         *        are visited element by element.
+         * @param item [in] Register map, register block, register array or register.
+         * @param f [in] Callable object, called with a reference to each register.
+         * @note Members that are not registers, register blocks or register arrays are skipped.
+         */
+        template<typename T, typename F>
+        void for_each_register(T& item, F& f) noexcept {
+          if constexpr (mmio_hardware_register<T>){
+            f(item);
+          } else if constexpr (is_strided_array<T>::value){
+            for(auto& element : item){
+              for_each_register(element, f);
+            }
+          } else if constexpr (std::is_class_v<T> && std::is_aggregate_v<T>){
+            for_each_member(item, [&f](auto& member){ for_each_register(member, f); });
+          }
+        }
+    }
+
+    /**
+     * @brief Non-volatile copy of the registers of a register map, same layout as the register map.
+     * @tparam RegisterMap Register map class, must be an aggregate without C array members.
+     *
+     * @details
+     * capture() reads every readable register in declaration order, restore() writes back every read/write register in
+     * declaration order with the value masked by the register WriteMask(). Registers are skipped according to their
+     * policy:
+     * - Reserved registers : not read, not written.
+     * - Write-only registers : not read, not written, the register value is unknown.
+     * - Read-only and write-one-to-clear registers : read, not written.
+     * - Read-to-clear registers : not read, the read would clear the register.
+     * The register visits are unrolled at compile time, register arrays are visited with a loop.
+     *
+     * @note Runtime only, the values are stored with memcpy so a snapshot cannot be built in a constant expression.
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  auto saved = uart->snapshot();      // before entering a low power mode.
+     *  enter_stop_mode();
+     *  uart->restore(saved);               // after wake-up, CTRL is written last if declared last.
+     *
+     * @endcode
+     */
+    template<typename RegisterMap>
+    requires (std::is_class_v<RegisterMap> && std::is_standard_layout_v<RegisterMap>)
+    struct register_snapshot final {
+      public:
+        using register_map = RegisterMap;
+
+        /**
+         * @brief Reads the readable registers of a register map into the snapshot.
+         * @param registers [in] Register map.
+         */
+        void capture(register_map& registers) noexcept {
+          static_assert(std::is_aggregate_v<register_map>, "Register map must be an aggregate.");
+          auto read_register = [this, &registers](auto& reg) noexcept {
+            using reg_type = std::remove_cvref_t<decltype(reg)>;
+
+            if constexpr (is_captured<reg_type>()){
+              const auto value = reg.read();
+              std::memcpy(storage.data() + offset_of(registers, reg), &value, sizeof(value));
+            }
+          };
+          details::for_each_register(registers, read_register);
+        }
+        /**
+         * @brief Writes the snapshot into the read/write registers of a register map.
+         * @param registers [in] Register map.
+         */
+        void restore(register_map& registers) const noexcept {
+          static_assert(std::is_aggregate_v<register_map>, "Register map must be an aggregate.");
+          auto write_register = [this, &registers](auto& reg) noexcept {
+            using reg_type = std::remove_cvref_t<decltype(reg)>;
+            using value_t = typename reg_type::value_type;
+
+            if constexpr (is_restored<reg_type>()){
+              value_t value;
+              std::memcpy(&value, storage.data() + offset_of(registers, reg), sizeof(value));
+              reg.write(static_cast<value_t>(value & reg_type::WriteMask()));
+            }
+          };
+          details::for_each_register(registers, write_register);
+        }
+        /**
+         * @brief Same as restore(), but only the registers whose value differs from the snapshot are written.
+         * @param registers [in] Register map.
+         * @return Number of registers written.
+         * @note Each read/write register is read once, only the bits in WriteMask() are compared.
+         */
+        std::size_t apply(register_map& registers) const noexcept {
+          static_assert(std::is_aggregate_v<register_map>, "Register map must be an aggregate.");
+          std::size_t count = 0;
+          auto write_changed = [this, &registers, &count](auto& reg) noexcept {
+            using reg_type = std::remove_cvref_t<decltype(reg)>;
+            using value_t = typename reg_type::value_type;
+
+            if constexpr (is_restored<reg_type>()){
+              value_t value;
+              std::memcpy(&value, storage.data() + offset_of(registers, reg), sizeof(value));
+              const auto desired = static_cast<value_t>(value & reg_type::WriteMask());
+
+              if(static_cast<value_t>(reg.read() & reg_type::WriteMask()) != desired){
+                reg.write(desired);
+                ++count;
+              }
+            }
+          };
+          details::for_each_register(registers, write_changed);
+          return count;
+        }
+        /**
+         * @brief Gets the snapshot value of a register.
+         * @tparam Member Register member pointer, ex: &uart_register_map::CTRL.
+         * @return Register value, 0 if the register is not captured.
+         */
+        template<auto Member>
+        requires register_map_member<Member, register_map>
+        [[nodiscard]] auto get() const noexcept -> typename register_member_t<Member>::value_type {
+          typename register_member_t<Member>::value_type value;
+          std::memcpy(&value, storage.data() + offset_of<Member>(), sizeof(value));
+          return value;
+        }
+        /**
+         * @brief Sets the snapshot value of a register, ex: to change a saved value before restore().
+         * @tparam Member Register member pointer, ex: &uart_register_map::CTRL.
+         * @param value [in] Register value.
+         */
+        template<auto Member>
+        requires register_map_member<Member, register_map>
+        void set(const typename register_member_t<Member>::value_type value) noexcept {
+          std::memcpy(storage.data() + offset_of<Member>(), &value, sizeof(value));
+        }
+
+      private:
+        /**
+         * @brief Checks if a register is read by capture().
+         */
+        template<typename Reg>
+        static consteval bool is_captured() noexcept {
+          return Reg::has_read_access() &&
+                 !mmio_register_policy_read_clear<register_access_policy<Reg>, typename Reg::value_type>;
+        }
+        /**
+         * @brief Checks if a register is written by restore().
+         */
+        template<typename Reg>
+        static consteval bool is_restored() noexcept {
+          return Reg::has_read_write_access();
+        }
+        /**
+         * @brief Byte offset of a register in the register map.
+         */
+        template<typename Reg>
+        static std::size_t offset_of(const register_map& registers, const Reg& reg) noexcept {
+          return static_cast<std::size_t>(reinterpret_cast<const volatile std::byte*>(&reg) -
+                                          reinterpret_cast<const volatile std::byte*>(&registers));
+        }
+        template<auto Member>
+        [[nodiscard]] static std::size_t offset_of() noexcept {
+          return details::member_offset<Member>();
+        }
+
+        alignas(register_map) std::array<std::byte, sizeof(register_map)> storage { };
+    };
+
     /**
      * @brief Templated Memory Map IO device registers class.
      * @tparam RegisterMap Device register map class.
@@ -103,7 +330,28 @@ namespace embtl {
           return Alloc::allocate(sz, n);
         }
 
-        void operator delete(void*) noexcept { }
+        void operator delete(void* ptr) noexcept {
+          if constexpr (requires { Alloc::deallocate(ptr); }){
+            Alloc::deallocate(ptr);
+          }
+        }
+
+        /**
+         * @brief Reads the readable registers into a snapshot, see register_snapshot<>.
+         * @return Register snapshot.
+         */
+        [[nodiscard]] auto snapshot() noexcept -> register_snapshot<RegisterMap> {
+          register_snapshot<RegisterMap> saved;
+          saved.capture(*this);
+          return saved;
+        }
+        /**
+         * @brief Writes a snapshot back into the read/write registers, see register_snapshot<>.
+         * @param saved [in] Register snapshot.
+         */
+        void restore(const register_snapshot<RegisterMap>& saved) noexcept {
+          saved.restore(*this);
+        }
     };
 
     /**
@@ -139,6 +387,23 @@ namespace embtl {
         void operator delete (void* ptr) noexcept{
           DeviceAllocator::deallocate(ptr);
         }
+
+        /**
+         * @brief Reads the readable registers into a snapshot, see register_snapshot<>.
+         * @return Register snapshot.
+         */
+        [[nodiscard]] auto snapshot() noexcept -> register_snapshot<RegisterMap> {
+          register_snapshot<RegisterMap> saved;
+          saved.capture(*this);
+          return saved;
+        }
+        /**
+         * @brief Writes a snapshot back into the read/write registers, see register_snapshot<>.
+         * @param saved [in] Register snapshot.
+         */
+        void restore(const register_snapshot<RegisterMap>& saved) noexcept {
+          saved.restore(*this);
+        }
     };
 
 }
@@ -12,8 +12,11 @@
 #define EMBEDDED_TL_EMBEDDED_REGISTER_HPP
 
 #include <embedded_types.hpp>
+#include <embedded_bits.hpp>
 #include <embedded_policy.hpp>
 #include <embedded_concepts.hpp>
+#include <embedded_return_type.hpp>
+#include <embedded_wait.hpp>
 
 namespace embtl {
 
@@ -22,17 +25,20 @@ namespace embtl {
      * @tparam Policy Access policy for the register ex: Read-only, Write-Only, Read/Write, or Reserved.
      * @tparam Base Register variable type.
      * @tparam Mask Register Write mask.
-     * @tparam Reset Register reset value.
+     * @tparam Reset Register reset value, the policy reset value if the policy has one (ex: shadowed write-only).
      */
     template<typename Policy, embedded_base_type Base = arch_type,
             Base Mask = std::numeric_limits<Base>::max(),
-            Base Reset = std::numeric_limits<Base>::min()>
+            Base Reset = policy::policy_reset_v<Policy, Base>>
     struct basic_hardware_register final {
       public:
         using value_type = Base;
         using access_policy = Policy;
         using access_side_effect = policy::policy_side_effect_t<access_policy>;
 
+        static_assert(!requires { Policy::reset_value; } || Reset == policy::policy_reset_v<Policy, Base>,
+                      "Register Reset must match the policy reset value, set it in the policy only.");
+
         // Compile time checks
         /**
          * @brief Get the write mask for the register.
@@ -48,38 +54,43 @@ namespace embtl {
          * @brief Check if access policy allows reads.
          * @return true := Reads allowed; false := Reads not allowed.
          */
-        static consteval bool has_read_access() noexcept { return mmio_register_policy_read_only<access_policy>; }
+        static consteval bool has_read_access() noexcept { return mmio_register_policy_read_only<access_policy, value_type>; }
         /**
          * @brief Check if access policy allows writes.
          * @return true := Writes allowed; false : Writes not allowed.
          */
-        static consteval bool has_write_access() noexcept { return mmio_register_policy_write_only<access_policy>; }
+        static consteval bool has_write_access() noexcept { return mmio_register_policy_write_only<access_policy, value_type>; }
         /**
          * @brief Checks if access policy allows reads and writes.
          * @return true := Reads and Writes allowed; false := Read and Write access not allowed.
          */
-        static consteval bool has_read_write_access() noexcept { return mmio_register_policy_read_write<access_policy>; }
+        static consteval bool has_read_write_access() noexcept { return mmio_register_policy_read_write<access_policy, value_type>; }
+        /**
+         * @brief Checks if access policy clears the bits written as 1 (write-one-to-clear).
+         * @return true := Write-one-to-clear register; false := not a write-one-to-clear register.
+         */
+        static consteval bool has_write_1_clear_access() noexcept { return mmio_register_policy_write_1_clear<access_policy, value_type>; }
         /**
          * @brief Checks if the register is reserved.
          * @return true := register is reversed; false := the register is not reserved.
          */
         static consteval bool is_reserved() noexcept {
-          return !(mmio_register_policy_read_write<access_policy> ||
-                  mmio_register_policy_read_only<access_policy> ||
-                  mmio_register_policy_write_only<access_policy>);
+          return !(mmio_register_policy_read_write<access_policy, value_type> ||
+                  mmio_register_policy_read_only<access_policy, value_type> ||
+                  mmio_register_policy_write_only<access_policy, value_type>);
         }
         /**
          * @brief Checks if register has side effects
          * @return true := side effect is implemented; false := no side effect is implemented.
          */
         static consteval bool has_side_effect() noexcept {
-          return mmio_side_effect_write_only<access_side_effect> ||
-                 mmio_side_effect_read_only<access_side_effect>; }
+          return mmio_side_effect_write_only<access_side_effect, value_type> ||
+                 mmio_side_effect_read_only<access_side_effect, value_type>; }
 
         basic_hardware_register() noexcept = default;
 
         explicit basic_hardware_register(const value_type value) noexcept
-        requires mmio_register_policy_write_only<access_policy> : reg(value){ }
+        requires mmio_register_policy_write_only<access_policy, value_type> : reg(value){ }
 
         basic_hardware_register(const basic_hardware_register&) noexcept = default;
         basic_hardware_register& operator=(const basic_hardware_register&) noexcept = default;
@@ -98,7 +109,7 @@ namespace embtl {
          * @note Only available if register has write-only or read/write policy.
          */
         void reset() noexcept
-        requires mmio_register_policy_write_only<access_policy>{
+        requires mmio_register_policy_write_only<access_policy, value_type>{
           access_policy::write(reg, Reset);
         }
         /**
@@ -107,8 +118,8 @@ namespace embtl {
          * @note Only available if register has read-only or read/write policy.
          */
         [[nodiscard]] value_type read() const noexcept
-        requires mmio_register_policy_read_only<access_policy> {
-          return access_policy::read(reg);
+        requires mmio_register_policy_read_only<access_policy, value_type> {
+          return access_policy::read(const_cast<volatile value_type&>(reg));
         }
         /**
          * @brief Read register method with side effect.
@@ -116,7 +127,7 @@ namespace embtl {
          * @note Only available if register has read-only or read/write policy.
          */
         [[nodiscard]] value_type read() noexcept
-        requires mmio_register_policy_read_only<access_policy> {
+        requires mmio_register_policy_read_only<access_policy, value_type> {
           return access_policy::read(reg);
         }
         /**
@@ -128,11 +139,11 @@ namespace embtl {
          * @note Only available if register has read-only or read/write policy.
          */
         [[nodiscard]] value_type get_field(std::size_t pos, std::size_t size = 1, bool shifted = true) const noexcept
-        requires mmio_register_policy_read_only<access_policy> {
-          return access_policy::get_field(reg, pos, size, shifted);
+        requires mmio_register_policy_read_only<access_policy, value_type> {
+          return access_policy::get_field(const_cast<volatile value_type&>(reg), pos, size, shifted);
         }
         [[nodiscard]] value_type get_field(std::size_t pos, std::size_t size = 1, bool shifted = true) noexcept
-        requires mmio_register_policy_read_only<access_policy> {
+        requires mmio_register_policy_read_only<access_policy, value_type> {
           return access_policy::get_field(reg, pos, size, shifted);
         }
         /**
@@ -144,7 +155,7 @@ namespace embtl {
          * @note Only available if register has read-only or read/write policy.
          */
         [[nodiscard]] value_type get_field(std::size_t pos, std::size_t size = 1, bool shifted = true) noexcept
-        requires (mmio_register_policy_read_only<access_policy> && mmio_side_effect_read_only<access_side_effect>) {
+        requires (mmio_register_policy_read_only<access_policy, value_type> && mmio_side_effect_read_only<access_side_effect, value_type>) {
           return access_policy::get_field(reg, pos, size, shifted);
         }
         /**
@@ -153,7 +164,7 @@ namespace embtl {
          * @note Only available if register has write-only or read/write policy.
          */
         void write(const value_type value) noexcept
-        requires mmio_register_policy_write_only<access_policy> {
+        requires mmio_register_policy_write_only<access_policy, value_type> {
           access_policy::write(reg, value);
         }
         /**
@@ -164,31 +175,186 @@ namespace embtl {
          * @note Only available if register has write-only or read/write policy.
          */
         void set_field(std::size_t pos, std::size_t size = 1, const value_type value = 1, bool shifted = false) noexcept
-        requires mmio_register_policy_read_write<access_policy> {
-          auto reg_value = this->read();    // Read register value.
-
-          reg_value &= ~make_mask<value_type>(pos, size);                                     // clear field.
-          auto masked_value = value & make_mask<value_type>(shifted ? pos : 0, size);     // mask value to field size
-
-          if(!shifted){
-            masked_value <<= pos;                                                             // Shift if value not already shifted
-          }
-
-          reg_value |= masked_value;                                                          // insert field into reg value
-
-          this->write(reg_value);                                                       // Write set field back to register.
+        requires mmio_register_policy_read_write<access_policy, value_type> {
+          access_policy::set_field(reg, pos, size, value, shifted);
         }
         /**
          * @brief Clear bit field method.
          * @param pos [in] Starting bit position of the field.
          * @param size [in] Size of the bit field. (default = 1)
-         * @note Only available if register has write-only or read/write policy.
+         * @note Only available if register has read/write or write-one-to-clear policy.
          */
         void clear_field(std::size_t pos, std::size_t size = 1) noexcept
-        requires mmio_register_policy_read_write<access_policy> {
-          auto value = this->read();
-          value &= ~make_mask<value_type>(pos, size);    // clear field.
-          this->write(value);
+        requires (mmio_register_policy_read_write<access_policy, value_type> || mmio_register_policy_write_1_clear<access_policy, value_type>) {
+          access_policy::clear_field(reg, pos, size);
+        }
+        /**
+         * @brief Clear bits method, single store of the bits to be cleared.
+         * @param mask [in] Bits to be cleared.
+         * @note Only available if register has write-one-to-clear policy.
+         */
+        void clear(const value_type mask) noexcept
+        requires mmio_register_policy_write_1_clear<access_policy, value_type> {
+          access_policy::clear_bits(reg, mask);
+        }
+        /**
+         * @brief Clear register method, single read of the register.
+         * @note Only available if register has read-to-clear policy.
+         */
+        void clear() noexcept
+        requires mmio_register_policy_read_clear<access_policy, value_type> {
+          access_policy::clear(reg);
+        }
+
+        // Compile time bit field methods
+
+        /**
+         * @brief Get bit field method (const).
+         * @tparam Field Bit field descriptor, see embtl::field<>.
+         * @return Field value shifted to bit position 0.
+         * @note Only available if register has read-only or read/write policy.
+         */
+        template<register_bit_field Field>
+        [[nodiscard]] auto get() const noexcept -> field_value_t<Field, value_type>
+        requires mmio_register_policy_read_only<access_policy, value_type> {
+          static_assert(fields_fit<value_type, Field>(), "Field is outside of the register value type.");
+          return extract_field<value_type, Field>(this->read());
+        }
+        /**
+         * @brief Get bit field method with side effect.
+         * @tparam Field Bit field descriptor, see embtl::field<>.
+         * @return Field value shifted to bit position 0.
+         * @note Only available if register has read-only or read/write policy.
+         */
+        template<register_bit_field Field>
+        [[nodiscard]] auto get() noexcept -> field_value_t<Field, value_type>
+        requires mmio_register_policy_read_only<access_policy, value_type> {
+          static_assert(fields_fit<value_type, Field>(), "Field is outside of the register value type.");
+          return extract_field<value_type, Field>(this->read());
+        }
+        /**
+         * @brief Set bit field method.
+         * @tparam Field Bit field descriptor, see embtl::field<>.
+         * @param value [in] Field value, not shifted.
+         * @note Only available if register has read/write policy.
+         */
+        template<register_bit_field Field>
+        void set(const field_value_t<Field, value_type> value) noexcept
+        requires mmio_register_policy_read_write<access_policy, value_type> {
+          static_assert(fields_fit<value_type, Field>(), "Field is outside of the register value type.");
+          static_assert(fields_writable<Field>(), "Field overlaps bits outside of the register write mask.");
+          update(fields_mask<value_type, Field>(), insert_field<value_type, Field>(value));
+        }
+        /**
+         * @brief Clear bit field method.
+         * @tparam Field Bit field descriptor, see embtl::field<>.
+         * @note Only available if register has read/write or write-one-to-clear policy.
+         */
+        template<register_bit_field Field>
+        void clear() noexcept
+        requires (mmio_register_policy_read_write<access_policy, value_type> || mmio_register_policy_write_1_clear<access_policy, value_type>) {
+          static_assert(fields_fit<value_type, Field>(), "Field is outside of the register value type.");
+          static_assert(fields_writable<Field>(), "Field overlaps bits outside of the register write mask.");
+          if constexpr (mmio_register_policy_write_1_clear<access_policy, value_type>){
+            access_policy::clear_bits(reg, fields_mask<value_type, Field>());
+          } else {
+            update(fields_mask<value_type, Field>(), 0);
+          }
+        }
+        /**
+         * @brief Modify multiple bit fields with a single read and a single write.
+         * @tparam Fields Bit field descriptors, see embtl::field<>.
+         * @tparam Ts Field assignment value types.
+         * @param values [in] Field assignments, ex: reg.modify(FIELD_A{} = 1, FIELD_B{} = 2).
+         * @note Only available if register has read/write policy.
+         */
+        template<register_bit_field ... Fields, typename ... Ts>
+        void modify(const field_assignment<Fields, Ts> ... values) noexcept
+        requires (mmio_register_policy_read_write<access_policy, value_type> && sizeof...(Fields) > 0) {
+          static_assert(fields_fit<value_type, Fields...>(), "Field is outside of the register value type.");
+          static_assert(fields_writable<Fields...>(), "Field overlaps bits outside of the register write mask.");
+          static_assert(fields_disjoint<value_type, Fields...>(), "Fields overlap each other.");
+          update(fields_mask<value_type, Fields...>(), insert_fields<value_type>(values...));
+        }
+        /**
+         * @brief Write multiple bit fields starting from the register reset value, no register read.
+         * @tparam Fields Bit field descriptors, see embtl::field<>.
+         * @tparam Ts Field assignment value types.
+         * @param values [in] Field assignments, ex: reg.write_fields(FIELD_A{} = 1, FIELD_B{} = 2).
+         * @note Only available if register has write-only or read/write policy.
+         */
+        template<register_bit_field ... Fields, typename ... Ts>
+        void write_fields(const field_assignment<Fields, Ts> ... values) noexcept
+        requires (mmio_register_policy_write_only<access_policy, value_type> && sizeof...(Fields) > 0) {
+          static_assert(fields_fit<value_type, Fields...>(), "Field is outside of the register value type.");
+          static_assert(fields_writable<Fields...>(), "Field overlaps bits outside of the register write mask.");
+          static_assert(fields_disjoint<value_type, Fields...>(), "Fields overlap each other.");
+          constexpr auto reset_value = static_cast<value_type>(Reset & ~fields_mask<value_type, Fields...>());
+          this->write(static_cast<value_type>(reset_value | insert_fields<value_type>(values...)));
+        }
+
+        // Polling methods
+
+        /**
+         * @brief Waits until a bit field is equal to value, reads the register at most timeout times.
+         * @tparam Field Bit field descriptor, see embtl::field<>.
+         * @tparam Backoff Backoff policy called between two reads, see embtl::wait. (default = wait::spin)
+         * @tparam Counter Counter hook, reports the reads and cycles spent in the wait. (default = wait::no_counter)
+         * @param value [in] Field value, not shifted.
+         * @param timeout [in] Maximum number of register reads, the register is always read once.
+         * @param error_mask [in] Error bits, the wait stops if any of these bits is set. (default = 0)
+         * @return Last register value read; STATUS::OK := condition met; STATUS::TIMEOUT := condition not met;
+         *         STATUS::ERROR := an error bit is set.
+         * @note Only available if register has read-only or read/write policy.
+         *
+         * @example
+         * @code{.cpp}
+         *
+         *  if(uart->SR.wait_until<TXE, embtl::wait::wfe>(1, 10000).has_error()){ ... }
+         *
+         * @endcode
+         */
+        template<register_bit_field Field, wait_backoff_policy Backoff = wait::spin, wait_counter_policy Counter = wait::no_counter>
+        [[nodiscard]] auto wait_until(const field_value_t<Field, value_type> value, const std::size_t timeout,
+                                      const value_type error_mask = 0) noexcept -> basic_return_value_status<value_type, 0>
+        requires mmio_register_policy_read_only<access_policy, value_type> {
+          static_assert(fields_fit<value_type, Field>(), "Field is outside of the register value type.");
+          return poll<Backoff, Counter>([value](const value_type reg_v){ return extract_field<value_type, Field>(reg_v) == value; },
+                                        timeout, error_mask);
+        }
+        /**
+         * @brief Waits until any bit of mask is set, reads the register at most timeout times.
+         * @tparam Backoff Backoff policy called between two reads, see embtl::wait. (default = wait::spin)
+         * @tparam Counter Counter hook, reports the reads and cycles spent in the wait. (default = wait::no_counter)
+         * @param mask [in] Bits to wait for.
+         * @param timeout [in] Maximum number of register reads, the register is always read once.
+         * @param error_mask [in] Error bits, the wait stops if any of these bits is set. (default = 0)
+         * @return Last register value read; STATUS::OK := condition met; STATUS::TIMEOUT := condition not met;
+         *         STATUS::ERROR := an error bit is set.
+         * @note Only available if register has read-only or read/write policy.
+         */
+        template<wait_backoff_policy Backoff = wait::spin, wait_counter_policy Counter = wait::no_counter>
+        [[nodiscard]] auto wait_any(const value_type mask, const std::size_t timeout, const value_type error_mask = 0) noexcept
+        -> basic_return_value_status<value_type, 0>
+        requires mmio_register_policy_read_only<access_policy, value_type> {
+          return poll<Backoff, Counter>([mask](const value_type reg_v){ return (reg_v & mask) != 0; }, timeout, error_mask);
+        }
+        /**
+         * @brief Waits until all bits of mask are set, reads the register at most timeout times.
+         * @tparam Backoff Backoff policy called between two reads, see embtl::wait. (default = wait::spin)
+         * @tparam Counter Counter hook, reports the reads and cycles spent in the wait. (default = wait::no_counter)
+         * @param mask [in] Bits to wait for.
+         * @param timeout [in] Maximum number of register reads, the register is always read once.
+         * @param error_mask [in] Error bits, the wait stops if any of these bits is set. (default = 0)
+         * @return Last register value read; STATUS::OK := condition met; STATUS::TIMEOUT := condition not met;
+         *         STATUS::ERROR := an error bit is set.
+         * @note Only available if register has read-only or read/write policy.
+         */
+        template<wait_backoff_policy Backoff = wait::spin, wait_counter_policy Counter = wait::no_counter>
+        [[nodiscard]] auto wait_all(const value_type mask, const std::size_t timeout, const value_type error_mask = 0) noexcept
+        -> basic_return_value_status<value_type, 0>
+        requires mmio_register_policy_read_only<access_policy, value_type> {
+          return poll<Backoff, Counter>([mask](const value_type reg_v){ return (reg_v & mask) == mask; }, timeout, error_mask);
         }
 
         // Assignment operators
@@ -209,10 +375,15 @@ namespace embtl {
          * @return Reference to this class.
          * @note Only available if register has read/write policy.
          */
-        basic_hardware_register& operator &=(const value_type rhs) noexcept {
-          auto reg_v = this->read();
-          reg_v &= rhs;
-          this->write(reg_v);
+        basic_hardware_register& operator &=(const value_type rhs) noexcept
+        requires mmio_register_policy_read_write<access_policy, value_type> {
+          if constexpr (mmio_register_policy_atomic_bits<access_policy, value_type>){
+            access_policy::clear_bits(reg, static_cast<value_type>(~rhs));
+          } else {
+            auto reg_v = this->read();
+            reg_v &= rhs;
+            this->write(reg_v);
+          }
           return *this;
         }
         /**
@@ -221,10 +392,15 @@ namespace embtl {
          * @return Reference to this class.
          * @note Only available if register has read/write policy.
          */
-        basic_hardware_register& operator |=(const value_type rhs) noexcept {
-          auto reg_v = this->read();
-          reg_v |= rhs;
-          this->write(reg_v);
+        basic_hardware_register& operator |=(const value_type rhs) noexcept
+        requires mmio_register_policy_read_write<access_policy, value_type> {
+          if constexpr (mmio_register_policy_atomic_bits<access_policy, value_type>){
+            access_policy::set_bits(reg, rhs);
+          } else {
+            auto reg_v = this->read();
+            reg_v |= rhs;
+            this->write(reg_v);
+          }
           return *this;
         }
         /**
@@ -233,10 +409,15 @@ namespace embtl {
          * @return Reference to this class.
          * @note Only available if register has read/write policy.
          */
-        basic_hardware_register& operator ^=(const value_type rhs) noexcept {
-          auto reg_v = this->read();
-          reg_v ^= rhs;
-          this->write(reg_v);
+        basic_hardware_register& operator ^=(const value_type rhs) noexcept
+        requires mmio_register_policy_read_write<access_policy, value_type> {
+          if constexpr (mmio_register_policy_atomic_bits<access_policy, value_type>){
+            access_policy::toggle_bits(reg, rhs);
+          } else {
+            auto reg_v = this->read();
+            reg_v ^= rhs;
+            this->write(reg_v);
+          }
           return *this;
         }
 
@@ -408,6 +589,75 @@ namespace embtl {
           return this->read() <= rhs;
         }
       private:
+        /**
+         * @brief Checks if all field bits are within the register write mask.
+         */
+        template<register_bit_field ... Fields>
+        static consteval bool fields_writable() noexcept { return (fields_mask<value_type, Fields...>() & ~Mask) == 0; }
+        /**
+         * @brief Replaces the bits in clear_mask with set_value.
+         * @param clear_mask [in] Bits to be cleared.
+         * @param set_value [in] Bits to be set, must be within clear_mask.
+         * @details
+         * Policies with an atomic modify method update the register in a single atomic read-modify-write, policies
+         * with atomic bit operations clear and set the bits without reading the register, otherwise the register is
+         * updated with a single read and a single write.
+         */
+        void update(const value_type clear_mask, const value_type set_value) noexcept {
+          if constexpr (mmio_register_policy_atomic_modify<access_policy, value_type>){
+            access_policy::modify(reg, clear_mask, set_value);
+          } else if constexpr (mmio_register_policy_atomic_bits<access_policy, value_type>){
+            const auto clear_value = static_cast<value_type>(clear_mask & ~set_value);
+
+            if(clear_value != 0){
+              access_policy::clear_bits(reg, clear_value);
+            }
+            if(set_value != 0){
+              access_policy::set_bits(reg, set_value);
+            }
+          } else {
+            this->write(static_cast<value_type>((this->read() & ~clear_mask) | set_value));
+          }
+        }
+
+        /**
+         * @brief Polling loop of the wait methods.
+         * @param done [in] Condition on the register value.
+         * @param timeout [in] Maximum number of register reads.
+         * @param error_mask [in] Error bits, checked before the condition.
+         * @details
+         * The error bits and the condition are checked on the same register read, so read side effects happen once
+         * per iteration. The backoff policy is not called after the last read. Both STATUS::ERROR and STATUS::TIMEOUT
+         * are negative, has_error() is true for both.
+         */
+        template<typename Backoff, typename Counter, typename Done>
+        auto poll(const Done done, const std::size_t timeout, const value_type error_mask) noexcept
+        -> basic_return_value_status<value_type, 0> {
+          const auto start = Counter::now();
+          auto status = STATUS::TIMEOUT;
+          std::size_t iterations = 0;
+          value_type reg_v;
+
+          for(;;){
+            reg_v = this->read();
+            ++iterations;
+            if((reg_v & error_mask) != 0){
+              status = STATUS::ERROR;
+              break;
+            }
+            if(done(reg_v)){
+              status = STATUS::OK;
+              break;
+            }
+            if(iterations >= timeout){
+              break;
+            }
+            Backoff::backoff(iterations - 1);
+          }
+          Counter::record(iterations, Counter::now() - start);
+          return { reg_v, status };
+        }
+
         volatile value_type reg;
     };
 
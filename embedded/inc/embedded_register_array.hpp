@@ -0,0 +1,215 @@
+/**
+ * @file embedded_register_array.hpp
+ * @date 2024-10-15
+ * @author Robert Morley
+ *
+ * @brief Embedded Template Library : Register array and register block array template header file.
+ *
+ * @version v0.1.0
+ * @copyright Copyright (c) 2024
+ */
+#ifndef EMBEDDED_TL_EMBEDDED_REGISTER_ARRAY_HPP
+#define EMBEDDED_TL_EMBEDDED_REGISTER_ARRAY_HPP
+
+#include <cstddef>
+#include <iterator>
+
+#include <embedded_types.hpp>
+#include <embedded_concepts.hpp>
+#include <embedded_register.hpp>
+
+namespace embtl {
+
+    namespace details {
+        /**
+         * @brief Array element with reserved bytes up to the stride of the array.
+         * @tparam T Element type.
+         * @tparam Stride Distance in bytes between two elements.
+         */
+        template<typename T, std::size_t Stride>
+        struct strided_slot final {
+            T item;
+            std::byte reserved[Stride - sizeof(T)];
+        };
+        /**
+         * @brief Array element storage type, no reserved bytes if the stride is the size of the element.
+         */
+        template<typename T, std::size_t Stride>
+        using strided_slot_t = std::conditional_t<Stride == sizeof(T), T, strided_slot<T, Stride>>;
+        /**
+         * @brief Element of an array slot.
+         */
+        template<typename T, typename Slot>
+        constexpr T& slot_item(Slot& slot) noexcept {
+          if constexpr (std::is_same_v<std::remove_const_t<Slot>, std::remove_const_t<T>>){
+            return slot;
+          } else {
+            return slot.item;
+          }
+        }
+
+        /**
+         * @brief Array of register or register blocks at a fixed stride.
+         * @tparam T Register or register block type.
+         * @tparam N Number of elements.
+         * @tparam Stride Distance in bytes between two elements.
+         */
+        template<typename T, std::size_t N, std::size_t Stride>
+        requires ((N > 0) && (Stride >= sizeof(T)) && (Stride % alignof(T) == 0))
+        struct basic_strided_array final {
+          private:
+            using slot_type = strided_slot_t<T, Stride>;
+
+          public:
+            using value_type = T;
+            using size_type = std::size_t;
+            using reference = T&;
+            using const_reference = const T&;
+
+            static_assert(sizeof(slot_type) == Stride, "Array stride does not match the element layout.");
+
+            /**
+             * @brief Array iterator, visits the elements in address order.
+             * @tparam Const true := const iterator; false := iterator.
+             */
+            template<bool Const>
+            struct basic_iterator final {
+              public:
+                using iterator_concept = std::forward_iterator_tag;
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = std::conditional_t<Const, const T*, T*>;
+                using reference = std::conditional_t<Const, const T&, T&>;
+
+                basic_iterator() noexcept = default;
+                explicit basic_iterator(std::conditional_t<Const, const slot_type*, slot_type*> ptr) noexcept : slot(ptr) { }
+
+                reference operator*() const noexcept { return slot_item<std::remove_reference_t<reference>>(*slot); }
+                pointer operator->() const noexcept { return &(**this); }
+
+                basic_iterator& operator++() noexcept {
+                  ++slot;
+                  return *this;
+                }
+                basic_iterator operator++(int) noexcept {
+                  auto prev = *this;
+                  ++slot;
+                  return prev;
+                }
+
+                bool operator==(const basic_iterator&) const noexcept = default;
+
+              private:
+                std::conditional_t<Const, const slot_type*, slot_type*> slot { nullptr };
+            };
+
+            using iterator = basic_iterator<false>;
+            using const_iterator = basic_iterator<true>;
+
+            /**
+             * @brief Number of elements.
+             */
+            static constexpr size_type size() noexcept { return N; }
+            /**
+             * @brief Distance in bytes between two elements.
+             */
+            static constexpr size_type stride() noexcept { return Stride; }
+            /**
+             * @brief Element access with a compile time index, the element offset is a constant.
+             * @tparam I Element index.
+             * @return Reference to element I.
+             */
+            template<size_type I>
+            requires (I < N)
+            reference get() noexcept { return slot_item<T>(slots[I]); }
+
+            template<size_type I>
+            requires (I < N)
+            const_reference get() const noexcept { return slot_item<const T>(slots[I]); }
+            /**
+             * @brief Element access with a run time index, the element offset is index * Stride.
+             * @param index [in] Element index, must be less than N.
+             * @return Reference to element index.
+             */
+            reference operator[](const size_type index) noexcept { return slot_item<T>(slots[index]); }
+
+            const_reference operator[](const size_type index) const noexcept { return slot_item<const T>(slots[index]); }
+
+            iterator begin() noexcept { return iterator { &slots[0] }; }
+            iterator end() noexcept { return iterator { &slots[0] + N }; }
+            const_iterator begin() const noexcept { return const_iterator { &slots[0] }; }
+            const_iterator end() const noexcept { return const_iterator { &slots[0] + N }; }
+            const_iterator cbegin() const noexcept { return begin(); }
+            const_iterator cend() const noexcept { return end(); }
+
+          private:
+            slot_type slots[N];
+        };
+    }
+
+    /**
+     * @brief Array of N registers of the same type, Stride bytes apart.
+     * @tparam Reg Register type, basic_hardware_register<>.
+     * @tparam N Number of registers.
+     * @tparam Stride Distance in bytes between two registers. (default = sizeof(Reg))
+     *
+     * @details
+     * Used in a register map in place of repeated registers, ex: timer CCR1..CCR4 or GPIO alternate function
+     * registers. The bytes between two registers, if Stride is larger than the register, are reserved.
+     * get<I>() accesses a register at a compile time offset, operator[] at index * Stride, and the array can be
+     * used in a range-for loop.
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  struct timer_register_map {
+     *      reg_rw CTRL;
+     *      reg_rw CNT;
+     *      embtl::register_array<reg_rw, 4> CCR;   // CCR1..CCR4
+     *  };
+     *
+     *  timer->CCR.get<0>() = 1000;                 // constant offset.
+     *  timer->CCR[channel] = compare;              // single stride multiply.
+     *  for(auto& ccr : timer->CCR){ ccr = 0; }
+     *
+     * @endcode
+     */
+    template<typename Reg, std::size_t N, std::size_t Stride = sizeof(Reg)>
+    requires mmio_hardware_register<Reg>
+    using register_array = details::basic_strided_array<Reg, N, Stride>;
+
+    /**
+     * @brief Array of N register blocks, ex: DMA channels, Stride bytes apart.
+     * @tparam Block Register block class, standard layout class of registers.
+     * @tparam N Number of register blocks.
+     * @tparam Stride Distance in bytes between two register blocks. (default = sizeof(Block))
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  struct dma_channel_registers {
+     *      reg_rw CCR;
+     *      reg_rw CNDTR;
+     *      reg_rw CPAR;
+     *      reg_rw CMAR;
+     *      reg_reserved RES;
+     *  };
+     *
+     *  struct dma_register_map {
+     *      reg_ro ISR;
+     *      reg_wo IFCR;
+     *      embtl::register_block_array<dma_channel_registers, 7> CH;
+     *  };
+     *
+     *  dma->CH.get<2>().CNDTR = length;
+     *  dma->CH[channel].CCR |= DMA_CCR_EN;
+     *
+     * @endcode
+     */
+    template<typename Block, std::size_t N, std::size_t Stride = sizeof(Block)>
+    requires (std::is_class_v<Block> && std::is_standard_layout_v<Block> && !mmio_hardware_register<Block>)
+    using register_block_array = details::basic_strided_array<Block, N, Stride>;
+}
+
+#endif //EMBEDDED_TL_EMBEDDED_REGISTER_ARRAY_HPP
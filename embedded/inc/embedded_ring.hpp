@@ -0,0 +1,299 @@
+/**
+ * @file embedded_ring.hpp
+ * @date 2024-10-17
+ * @author Robert Morley
+ *
+ * @brief Embedded Template Library : Lock-free ring buffer header file.
+ *
+ * @version v0.1.0
+ * @copyright Copyright (c) 2024
+ */
+#ifndef EMBEDDED_TL_EMBEDDED_RING_HPP
+#define EMBEDDED_TL_EMBEDDED_RING_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include <embedded_types.hpp>
+#include <embedded_return_type.hpp>
+
+namespace embtl {
+
+    /**
+     * @brief Default alignment separating the producer and consumer indexes, one cache line.
+     * @note 64 bytes for host builds, Cortex-M7 lines are 32 bytes; a larger value only costs RAM.
+     */
+    inline constexpr std::size_t cache_line_size = 64;
+
+    /**
+     * @brief Single producer single consumer (SPSC) ring buffer, lock-free and wait-free.
+     * @tparam T Element type.
+     * @tparam N Capacity, a power of two.
+     * @tparam Align Alignment of the producer index, the consumer index and the buffer. (default = cache_line_size)
+     * @details
+     * One producer (ex: an interrupt handler) and one consumer (ex: the main loop or a thread) exchange elements without
+     * lock and without disabling interrupts. Every method finishes in a bounded number of steps (wait-free).
+     *
+     * The head (producer) and tail (consumer) indexes run freely and are masked with N - 1. Each index is on its own
+     * cache line with a cached copy of the other index, the other side's line is only read when the ring looks full
+     * (producer) or empty (consumer). The producer publishes elements with a release store of head, the consumer frees
+     * slots with a release store of tail.
+     *
+     * @note Only the producer may call push methods and only the consumer pop methods.
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  embtl::basic_spsc_ring<std::uint8_t, 256> uart_rx;
+     *
+     *  void USART1_IRQHandler() { uart_rx.push(static_cast<std::uint8_t>(USART1->DR)); }
+     *
+     *  std::array<std::uint8_t, 64> line;
+     *  const auto n = uart_rx.pop_n(line);
+     *
+     * @endcode
+     *
+     * @note Unit Tested.
+     */
+    template<typename T, std::size_t N, std::size_t Align = cache_line_size>
+    requires (std::has_single_bit(N) && std::has_single_bit(Align) &&
+              std::is_nothrow_default_constructible_v<T> && std::is_nothrow_copy_assignable_v<T>)
+    class basic_spsc_ring final {
+      public:
+        using value_type = T;
+
+        basic_spsc_ring() noexcept = default;
+
+        basic_spsc_ring(const basic_spsc_ring&) = delete;
+        basic_spsc_ring& operator=(const basic_spsc_ring&) = delete;
+
+        static constexpr std::size_t capacity() noexcept { return N; }
+        /**
+         * @brief Adds one element, producer only.
+         * @param value [in] Element.
+         * @return true := added; false := ring full.
+         */
+        bool push(const T& value) noexcept {
+          const auto h = head.load(std::memory_order_relaxed);
+          if(h - producer_tail == N){
+            producer_tail = tail.load(std::memory_order_acquire);
+            if(h - producer_tail == N){
+              return false;
+            }
+          }
+          buffer[h & mask] = value;
+          head.store(h + 1, std::memory_order_release);
+          return true;
+        }
+        /**
+         * @brief Adds as many elements as fit, producer only.
+         * @param values [in] Elements.
+         * @return Number of elements added, from the front of values.
+         */
+        std::size_t push_n(const std::span<const T> values) noexcept {
+          const auto h = head.load(std::memory_order_relaxed);
+          if(N - (h - producer_tail) < values.size()){
+            producer_tail = tail.load(std::memory_order_acquire);
+          }
+          const auto count = std::min(values.size(), N - (h - producer_tail));
+          const auto start = h & mask;
+          const auto first = std::min(count, N - start);
+
+          std::copy_n(values.begin(), first, buffer.begin() + static_cast<std::ptrdiff_t>(start));
+          std::copy_n(values.begin() + static_cast<std::ptrdiff_t>(first), count - first, buffer.begin());
+          head.store(h + count, std::memory_order_release);
+          return count;
+        }
+        /**
+         * @brief Removes one element, consumer only.
+         * @param value [out] Element.
+         * @return true := removed; false := ring empty.
+         */
+        bool pop(T& value) noexcept {
+          const auto t = tail.load(std::memory_order_relaxed);
+          if(t == consumer_head){
+            consumer_head = head.load(std::memory_order_acquire);
+            if(t == consumer_head){
+              return false;
+            }
+          }
+          value = buffer[t & mask];
+          tail.store(t + 1, std::memory_order_release);
+          return true;
+        }
+        /**
+         * @brief Removes as many elements as available, consumer only.
+         * @param values [out] Elements.
+         * @return Number of elements removed, to the front of values.
+         */
+        std::size_t pop_n(const std::span<T> values) noexcept {
+          const auto t = tail.load(std::memory_order_relaxed);
+          if(consumer_head - t < values.size()){
+            consumer_head = head.load(std::memory_order_acquire);
+          }
+          const auto count = std::min(values.size(), consumer_head - t);
+          const auto start = t & mask;
+          const auto first = std::min(count, N - start);
+
+          std::copy_n(buffer.begin() + static_cast<std::ptrdiff_t>(start), first, values.begin());
+          std::copy_n(buffer.begin(), count - first, values.begin() + static_cast<std::ptrdiff_t>(first));
+          tail.store(t + count, std::memory_order_release);
+          return count;
+        }
+        /**
+         * @brief Number of elements, exact for the producer or the consumer, a snapshot for other callers.
+         * @note tail is loaded before head, head never trails the loaded tail; the result is clamped to N for callers
+         *       racing with both sides.
+         */
+        [[nodiscard]] std::size_t size() const noexcept {
+          const auto t = tail.load(std::memory_order_acquire);
+          const auto h = head.load(std::memory_order_acquire);
+          return std::min(h - t, N);
+        }
+
+        [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+        [[nodiscard]] bool full() const noexcept { return size() == N; }
+
+      private:
+        static constexpr std::size_t mask = N - 1;
+
+        alignas(Align) std::atomic<std::size_t> head { 0 };
+        std::size_t producer_tail = 0;
+        alignas(Align) std::atomic<std::size_t> tail { 0 };
+        std::size_t consumer_head = 0;
+        alignas(Align) std::array<T, N> buffer { };
+    };
+
+    /**
+     * @brief Bounded multi producer multi consumer (MPMC) queue with sequence numbered slots (D. Vyukov).
+     * @tparam T Element type.
+     * @tparam N Capacity, a power of two, at least 2: with a single slot the full and free sequences are equal.
+     * @tparam Align Alignment of the producer position, the consumer position and the slots. (default = cache_line_size)
+     * @details
+     * Any number of threads, cores or interrupt handlers push and pop concurrently without lock and without heap.
+     * Each slot has a sequence number: a slot at position p can be written when its sequence is p and read when its
+     * sequence is p + 1, the reader sets it to p + N for the next round. A producer claims a position with one
+     * compare-exchange on the producer position, a consumer with one compare-exchange on the consumer position; the
+     * two positions are on separate cache lines.
+     *
+     * push() and pop() never wait for another thread: if a slot is still being written or read by a preempted thread
+     * (ex: an interrupt handler preempting a push on the same core), the queue is reported full or empty.
+     *
+     * The queue is constant initialized, it can be a global variable used before static initialization.
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  constinit embtl::basic_mpmc_queue<work_item, 32> work_queue;
+     *
+     *  void TIM2_IRQHandler() { work_queue.push({ work_type::SAMPLE, TIM2->CCR1 }); }   // core 0
+     *  void CAN1_RX0_IRQHandler() { work_queue.push({ work_type::FRAME, CAN1->RDLR }); } // core 1
+     *
+     *  work_item item;
+     *  while(work_queue.pop(item).has_value()){ ... }
+     *
+     * @endcode
+     *
+     * @note Unit Tested.
+     */
+    template<typename T, std::size_t N, std::size_t Align = cache_line_size>
+    requires (N >= 2 && std::has_single_bit(N) && std::has_single_bit(Align) &&
+              std::is_nothrow_default_constructible_v<T> && std::is_nothrow_copy_assignable_v<T>)
+    class basic_mpmc_queue final {
+      public:
+        using value_type = T;
+        using return_type = basic_return_value_status<std::size_t, 0>;
+
+        constexpr basic_mpmc_queue() noexcept : slots(make_slots(std::make_index_sequence<N>{})) { }
+
+        basic_mpmc_queue(const basic_mpmc_queue&) = delete;
+        basic_mpmc_queue& operator=(const basic_mpmc_queue&) = delete;
+
+        static constexpr std::size_t capacity() noexcept { return N; }
+        /**
+         * @brief Adds one element.
+         * @param value [in] Element.
+         * @return Queue position of the element; STATUS::OK := added; STATUS::BUFFER_OVERFLOW := queue full.
+         */
+        return_type push(const T& value) noexcept {
+          auto position = push_position.load(std::memory_order_relaxed);
+          for(;;){
+            auto& item = slots[position & mask];
+            const auto sequence = item.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - position);
+
+            if(diff == 0){
+              if(push_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)){
+                item.value = value;
+                item.sequence.store(position + 1, std::memory_order_release);
+                return { position, STATUS::OK };
+              }
+            } else if(diff < 0){
+              return { 0, STATUS::BUFFER_OVERFLOW };
+            } else {
+              position = push_position.load(std::memory_order_relaxed);
+            }
+          }
+        }
+        /**
+         * @brief Removes the oldest element.
+         * @param value [out] Element.
+         * @return Queue position of the element; STATUS::OK := removed; STATUS::NOT_AVAILABLE := queue empty.
+         */
+        return_type pop(T& value) noexcept {
+          auto position = pop_position.load(std::memory_order_relaxed);
+          for(;;){
+            auto& item = slots[position & mask];
+            const auto sequence = item.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+
+            if(diff == 0){
+              if(pop_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)){
+                value = item.value;
+                item.sequence.store(position + N, std::memory_order_release);
+                return { position, STATUS::OK };
+              }
+            } else if(diff < 0){
+              return { 0, STATUS::NOT_AVAILABLE };
+            } else {
+              position = pop_position.load(std::memory_order_relaxed);
+            }
+          }
+        }
+        /**
+         * @brief Number of elements, a snapshot.
+         */
+        [[nodiscard]] std::size_t size() const noexcept {
+          const auto pushed = push_position.load(std::memory_order_acquire);
+          const auto popped = pop_position.load(std::memory_order_acquire);
+          return pushed > popped ? std::min(pushed - popped, N) : 0;
+        }
+
+        [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+      private:
+        struct slot {
+            std::atomic<std::size_t> sequence;
+            T value;
+        };
+
+        static constexpr std::size_t mask = N - 1;
+
+        template<std::size_t ... Position>
+        static constexpr std::array<slot, N> make_slots(std::index_sequence<Position...>) noexcept {
+          return { slot { Position, T { } } ... };
+        }
+
+        alignas(Align) std::atomic<std::size_t> push_position { 0 };
+        alignas(Align) std::atomic<std::size_t> pop_position { 0 };
+        alignas(Align) std::array<slot, N> slots;
+    };
+}
+
+#endif //EMBEDDED_TL_EMBEDDED_RING_HPP
@@ -0,0 +1,288 @@
+/**
+ * @file embedded_transaction.hpp
+ * @date 2024-10-12
+ * @author Robert Morley
+ *
+ * @brief Embedded Template Library : Deferred register transaction template header file.
+ *
+ * @version v0.1.0
+ * @copyright Copyright (c) 2024
+ */
+#ifndef EMBEDDED_TL_EMBEDDED_TRANSACTION_HPP
+#define EMBEDDED_TL_EMBEDDED_TRANSACTION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <bit>
+
+#include <embedded_types.hpp>
+#include <embedded_bits.hpp>
+#include <embedded_concepts.hpp>
+#include <embedded_register.hpp>
+#include <embedded_region.hpp>
+
+namespace embtl {
+
+    /**
+     * @brief Deferred register transaction template class.
+     * @tparam RegisterMap Register map class, represents register map of device.
+     *
+     * @details
+     * Register writes made through the transaction are stored in a non-volatile staging area instead of the device
+     * registers, each register is staged in its own value type at its register map offset. The first read-modify-write
+     * access to a register loads the register value (or the register reset value for registers without read access) into
+     * the staging area, all following accesses only modify the staged value.
+     * The commit() method writes each touched register once, in declaration order or with the commit<Members...>()
+     * method in the order given first. Pending writes are committed when the transaction is destroyed.
+     *
+     * @example
+     * @code{.cpp}
+     *
+     *  void uart_driver::init() noexcept {
+     *    register_transaction tx { *reg_map };
+     *
+     *    tx.write<&uart_register_map::BAUD>(0x68);
+     *    tx.set<&uart_register_map::CTRL, UART_CTRL_PARITY>(uart_parity::EVEN);
+     *    tx.modify<&uart_register_map::CTRL>(UART_CTRL_TXEN{} = 1, UART_CTRL_RXEN{} = 1);
+     *
+     *    tx.commit<&uart_register_map::BAUD, &uart_register_map::CTRL>(); // BAUD is written before CTRL.
+     *  }
+     *
+     * @endcode
+     */
+    template<typename RegisterMap>
+    requires (std::is_class_v<RegisterMap> && std::is_standard_layout_v<RegisterMap>)
+    struct register_transaction final {
+      public:
+        using register_map = RegisterMap;
+
+        explicit register_transaction(register_map& registers) noexcept : regs(registers) { }
+
+        register_transaction(const register_transaction&) = delete;
+        register_transaction& operator=(const register_transaction&) = delete;
+        register_transaction(register_transaction&&) = delete;
+        register_transaction& operator=(register_transaction&&) = delete;
+
+        ~register_transaction() noexcept {
+          commit();
+        }
+        /**
+         * @brief Stages a register write.
+         * @tparam Member Register member pointer, ex: &uart_register_map::CTRL.
+         * @param value [in] Value to be written to the register on commit.
+         * @note Only available if the register has write-only or read/write policy.
+         */
+        template<auto Member>
+        requires register_map_member<Member, register_map>
+        void write(const typename register_member_t<Member>::value_type value) noexcept {
+          static_assert(register_member_t<Member>::has_write_access(), "Register does not have write access.");
+          store<Member>(value);
+        }
+        /**
+         * @brief Stages a register bit field update.
+         * @tparam Member Register member pointer, ex: &uart_register_map::CTRL.
+         * @tparam Field Bit field descriptor, see embtl::field<>.
+         * @param value [in] Field value, not shifted.
+         * @note Only available if the register has write-only or read/write policy, not for write-one-to-clear registers.
+         */
+        template<auto Member, register_bit_field Field>
+        requires register_map_member<Member, register_map>
+        void set(const field_value_t<Field, typename register_member_t<Member>::value_type> value) noexcept {
+          using value_t = member_value_t<Member>;
+          static_assert(!register_member_t<Member>::has_write_1_clear_access(), "Use clear<>() for write-one-to-clear registers.");
+          static_assert(fields_fit<value_t, Field>(), "Field is outside of the register value type.");
+          static_assert(fields_writable<Member, Field>(), "Field overlaps bits outside of the register write mask.");
+          store<Member>(static_cast<value_t>((load<Member>() & ~fields_mask<value_t, Field>()) | insert_field<value_t, Field>(value)));
+        }
+        /**
+         * @brief Stages a register bit field clear.
+         * @tparam Member Register member pointer, ex: &uart_register_map::CTRL.
+         * @tparam Field Bit field descriptor, see embtl::field<>.
+         * @note Only available if the register has write-only or read/write policy. For write-one-to-clear registers
+         *       the field bits are staged as 1 in a value starting at 0, the commit writes only the bits to be cleared.
+         */
+        template<auto Member, register_bit_field Field>
+        requires register_map_member<Member, register_map>
+        void clear() noexcept {
+          using value_t = member_value_t<Member>;
+          static_assert(fields_fit<value_t, Field>(), "Field is outside of the register value type.");
+          static_assert(fields_writable<Member, Field>(), "Field overlaps bits outside of the register write mask.");
+          if constexpr (register_member_t<Member>::has_write_1_clear_access()){
+            store<Member>(static_cast<value_t>(load<Member>() | fields_mask<value_t, Field>()));
+          } else {
+            store<Member>(static_cast<value_t>(load<Member>() & ~fields_mask<value_t, Field>()));
+          }
+        }
+        /**
+         * @brief Stages multiple register bit field updates.
+         * @tparam Member Register member pointer, ex: &uart_register_map::CTRL.
+         * @param values [in] Field assignments, ex: tx.modify<&map::CTRL>(FIELD_A{} = 1, FIELD_B{} = 2).
+         * @note Only available if the register has write-only or read/write policy, not for write-one-to-clear registers.
+         */
+        template<auto Member, register_bit_field ... Fields, typename ... Ts>
+        requires (register_map_member<Member, register_map> && sizeof...(Fields) > 0)
+        void modify(const field_assignment<Fields, Ts> ... values) noexcept {
+          using value_t = member_value_t<Member>;
+          static_assert(!register_member_t<Member>::has_write_1_clear_access(), "Use clear<>() for write-one-to-clear registers.");
+          static_assert(fields_fit<value_t, Fields...>(), "Field is outside of the register value type.");
+          static_assert(fields_writable<Member, Fields...>(), "Field overlaps bits outside of the register write mask.");
+          static_assert(fields_disjoint<value_t, Fields...>(), "Fields overlap each other.");
+          store<Member>(static_cast<value_t>((load<Member>() & ~fields_mask<value_t, Fields...>()) | insert_fields<value_t>(values...)));
+        }
+        /**
+         * @brief Writes all staged registers once, in declaration order.
+         * @note The register visits are unrolled at compile time, only writable registers are checked.
+         */
+        void commit() noexcept {
+          auto write_staged = [this](auto& reg) noexcept {
+            using reg_type = std::remove_cvref_t<decltype(reg)>;
+
+            if constexpr (reg_type::has_write_access()){
+              flush(reg);
+            }
+          };
+          details::for_each_register(regs, write_staged);
+        }
+        /**
+         * @brief Writes the listed staged registers first in the order given, remaining staged registers in declaration
+         *        order.
+         * @tparam First First register member pointer to be written.
+         * @tparam Members Register member pointers to be written after First.
+         */
+        template<auto First, auto ... Members>
+        requires (register_map_member<First, register_map> && (register_map_member<Members, register_map> && ...))
+        void commit() noexcept {
+          flush(regs.*First);
+          (flush(regs.*Members), ...);
+          commit();
+        }
+        /**
+         * @brief Drops all staged register writes.
+         */
+        void discard() noexcept {
+          staged_flags.fill(0);
+        }
+        /**
+         * @brief Checks if a register has a staged write.
+         * @tparam Member Register member pointer, ex: &uart_register_map::CTRL.
+         * @return true := the register is written by the next commit; false := the register is not staged.
+         */
+        template<auto Member>
+        requires register_map_member<Member, register_map>
+        [[nodiscard]] bool is_pending() const noexcept {
+          return is_staged(offset_of(regs.*Member));
+        }
+        /**
+         * @brief Gets the staged value of a register.
+         * @tparam Member Register member pointer, ex: &uart_register_map::CTRL.
+         * @return Value written to the register by the next commit, only valid if is_pending<Member>() is true.
+         */
+        template<auto Member>
+        requires register_map_member<Member, register_map>
+        [[nodiscard]] auto get() const noexcept -> typename register_member_t<Member>::value_type {
+          typename register_member_t<Member>::value_type value;
+          std::memcpy(&value, storage.data() + offset_of(regs.*Member), sizeof(value));
+          return value;
+        }
+        /**
+         * @brief Number of registers with staged writes.
+         * @return Number of register writes a commit will perform.
+         */
+        [[nodiscard]] std::size_t pending() const noexcept {
+          std::size_t count = 0;
+
+          for(const auto flags : staged_flags){
+            count += static_cast<std::size_t>(std::popcount(flags));
+          }
+          return count;
+        }
+
+      private:
+        template<auto Member>
+        using member_value_t = typename register_member_t<Member>::value_type;
+        /**
+         * @brief Checks if all field bits are within the write mask of the register.
+         */
+        template<auto Member, register_bit_field ... Fields>
+        static consteval bool fields_writable() noexcept {
+          return (fields_mask<member_value_t<Member>, Fields...>() & ~register_member_t<Member>::WriteMask()) == 0;
+        }
+        /**
+         * @brief Byte offset of a register in the register map, also the staging area offset of the register.
+         */
+        template<typename Reg>
+        [[nodiscard]] std::size_t offset_of(const Reg& reg) const noexcept {
+          return static_cast<std::size_t>(reinterpret_cast<const volatile std::byte*>(&reg) -
+                                          reinterpret_cast<const volatile std::byte*>(&regs));
+        }
+        [[nodiscard]] bool is_staged(const std::size_t offset) const noexcept {
+          return (staged_flags[offset / 8U] & (1U << (offset % 8U))) != 0;
+        }
+        /**
+         * @brief Gets the staged value of a register, the register value (or the reset value for registers without read
+         *        access) if the register is not staged yet.
+         * @tparam Member Register member pointer.
+         * @return Staged register value, 0 for a write-one-to-clear register that is not staged (no bit to clear).
+         * @note Write-one-to-clear registers are never read, writing back the read flags would clear them all.
+         */
+        template<auto Member>
+        [[nodiscard]] member_value_t<Member> load() noexcept {
+          using register_t = register_member_t<Member>;
+          static_assert(register_t::has_write_access(), "Register does not have write access.");
+          const auto offset = offset_of(regs.*Member);
+
+          if(!is_staged(offset)){
+            if constexpr (register_t::has_write_1_clear_access()){
+              return 0;
+            } else if constexpr (register_t::has_read_access()){
+              return (regs.*Member).read();
+            } else {
+              return register_t::ResetValue();
+            }
+          }
+
+          return get<Member>();
+        }
+        /**
+         * @brief Stores a register value in the staging area.
+         * @tparam Member Register member pointer.
+         * @param value [in] Register value.
+         */
+        template<auto Member>
+        void store(const member_value_t<Member> value) noexcept {
+          const auto offset = offset_of(regs.*Member);
+          std::memcpy(storage.data() + offset, &value, sizeof(value));
+          staged_flags[offset / 8U] |= static_cast<std::uint8_t>(1U << (offset % 8U));
+        }
+        /**
+         * @brief Writes a staged register and removes it from the staging area.
+         * @param reg [in] Register of the register map.
+         */
+        template<typename Reg>
+        void flush(Reg& reg) noexcept {
+          using value_t = typename Reg::value_type;
+          const auto offset = offset_of(reg);
+
+          if(is_staged(offset)){
+            value_t value;
+            std::memcpy(&value, storage.data() + offset, sizeof(value));
+            reg.write(value);
+            staged_flags[offset / 8U] &= static_cast<std::uint8_t>(~(1U << (offset % 8U)));
+          }
+        }
+
+        register_map& regs;
+        alignas(register_map) std::array<std::byte, sizeof(register_map)> storage { };
+        std::array<std::uint8_t, (sizeof(register_map) + 7U) / 8U> staged_flags { };
+    };
+
+    template<typename RegisterMap, typename Alloc>
+    register_transaction(basic_mmio_device_registers<RegisterMap, Alloc>&) -> register_transaction<RegisterMap>;
+
+    template<typename RegisterMap, typename DeviceAllocator>
+    register_transaction(basic_device_region<RegisterMap, DeviceAllocator>&) -> register_transaction<RegisterMap>;
+}
+
+#endif //EMBEDDED_TL_EMBEDDED_TRANSACTION_HPP
@@ -53,6 +53,7 @@ concept bool_integral_constant = requires (T a){
         INVALID_PARAMETER,
         OUT_OF_RANGE,
         UNINITIALIZED,
+        TIMEOUT,
         OK = 0,
         BUSY,
         INITIALIZED
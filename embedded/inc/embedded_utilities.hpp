@@ -11,6 +11,9 @@
 #ifndef EMBEDDED_TEMPLATE_LIBRARY_EMBEDDED_UTILITIES_HPP
 #define EMBEDDED_TEMPLATE_LIBRARY_EMBEDDED_UTILITIES_HPP
 
+#include <type_traits>
+#include <utility>
+
 #include <embedded_types.hpp>
 
 namespace embtl {
@@ -37,6 +40,243 @@ namespace embtl {
       auto x = to_lower(c);
       return static_cast<std::size_t>(x - 'a');
     }
+
+    namespace details {
+        /**
+         * @brief Converts to any member type, used to count the members of an aggregate.
+         */
+        struct any_member final {
+            template<typename T>
+            constexpr operator T() const noexcept;
+        };
+        /**
+         * @brief Number of members of an aggregate, found by adding initializers until the initialization fails.
+         * @tparam T Aggregate type.
+         * @tparam Ts Initializer types found so far.
+         */
+        template<typename T, typename ... Ts>
+        consteval std::size_t aggregate_member_count() noexcept {
+          if constexpr (requires { T { Ts{}..., any_member{} }; }){
+            return aggregate_member_count<T, Ts..., any_member>();
+          } else {
+            return sizeof...(Ts);
+          }
+        }
+
+        template<typename F, typename ... Ts>
+        constexpr void visit_each(F& f, Ts& ... members){
+          (f(members), ...);
+        }
+        /**
+         * @brief Binds the members of an aggregate with Count members to a structured binding.
+         * @tparam Count Number of members of the aggregate.
+         * @note The specializations for 1 to max_aggregate_members members are generated with EMBEDDED_MEMBER_BINDER.
+         */
+        template<std::size_t Count>
+        struct member_binder;
+
+        template<>
+        struct member_binder<0> final {
+            template<typename T, typename F>
+            static constexpr void visit([[maybe_unused]] T& obj, [[maybe_unused]] F& f){ }
+        };
+
+/**
+ * @brief Structured binding identifier lists m0, m1, ..., m(N-1) for EMBEDDED_MEMBER_BINDER.
+ */
+#define EMBEDDED_MEMBERS_1 m0
+#define EMBEDDED_MEMBERS_2 EMBEDDED_MEMBERS_1, m1
+#define EMBEDDED_MEMBERS_3 EMBEDDED_MEMBERS_2, m2
+#define EMBEDDED_MEMBERS_4 EMBEDDED_MEMBERS_3, m3
+#define EMBEDDED_MEMBERS_5 EMBEDDED_MEMBERS_4, m4
+#define EMBEDDED_MEMBERS_6 EMBEDDED_MEMBERS_5, m5
+#define EMBEDDED_MEMBERS_7 EMBEDDED_MEMBERS_6, m6
+#define EMBEDDED_MEMBERS_8 EMBEDDED_MEMBERS_7, m7
+#define EMBEDDED_MEMBERS_9 EMBEDDED_MEMBERS_8, m8
+#define EMBEDDED_MEMBERS_10 EMBEDDED_MEMBERS_9, m9
+#define EMBEDDED_MEMBERS_11 EMBEDDED_MEMBERS_10, m10
+#define EMBEDDED_MEMBERS_12 EMBEDDED_MEMBERS_11, m11
+#define EMBEDDED_MEMBERS_13 EMBEDDED_MEMBERS_12, m12
+#define EMBEDDED_MEMBERS_14 EMBEDDED_MEMBERS_13, m13
+#define EMBEDDED_MEMBERS_15 EMBEDDED_MEMBERS_14, m14
+#define EMBEDDED_MEMBERS_16 EMBEDDED_MEMBERS_15, m15
+#define EMBEDDED_MEMBERS_17 EMBEDDED_MEMBERS_16, m16
+#define EMBEDDED_MEMBERS_18 EMBEDDED_MEMBERS_17, m17
+#define EMBEDDED_MEMBERS_19 EMBEDDED_MEMBERS_18, m18
+#define EMBEDDED_MEMBERS_20 EMBEDDED_MEMBERS_19, m19
+#define EMBEDDED_MEMBERS_21 EMBEDDED_MEMBERS_20, m20
+#define EMBEDDED_MEMBERS_22 EMBEDDED_MEMBERS_21, m21
+#define EMBEDDED_MEMBERS_23 EMBEDDED_MEMBERS_22, m22
+#define EMBEDDED_MEMBERS_24 EMBEDDED_MEMBERS_23, m23
+#define EMBEDDED_MEMBERS_25 EMBEDDED_MEMBERS_24, m24
+#define EMBEDDED_MEMBERS_26 EMBEDDED_MEMBERS_25, m25
+#define EMBEDDED_MEMBERS_27 EMBEDDED_MEMBERS_26, m26
+#define EMBEDDED_MEMBERS_28 EMBEDDED_MEMBERS_27, m27
+#define EMBEDDED_MEMBERS_29 EMBEDDED_MEMBERS_28, m28
+#define EMBEDDED_MEMBERS_30 EMBEDDED_MEMBERS_29, m29
+#define EMBEDDED_MEMBERS_31 EMBEDDED_MEMBERS_30, m30
+#define EMBEDDED_MEMBERS_32 EMBEDDED_MEMBERS_31, m31
+#define EMBEDDED_MEMBERS_33 EMBEDDED_MEMBERS_32, m32
+#define EMBEDDED_MEMBERS_34 EMBEDDED_MEMBERS_33, m33
+#define EMBEDDED_MEMBERS_35 EMBEDDED_MEMBERS_34, m34
+#define EMBEDDED_MEMBERS_36 EMBEDDED_MEMBERS_35, m35
+#define EMBEDDED_MEMBERS_37 EMBEDDED_MEMBERS_36, m36
+#define EMBEDDED_MEMBERS_38 EMBEDDED_MEMBERS_37, m37
+#define EMBEDDED_MEMBERS_39 EMBEDDED_MEMBERS_38, m38
+#define EMBEDDED_MEMBERS_40 EMBEDDED_MEMBERS_39, m39
+#define EMBEDDED_MEMBERS_41 EMBEDDED_MEMBERS_40, m40
+#define EMBEDDED_MEMBERS_42 EMBEDDED_MEMBERS_41, m41
+#define EMBEDDED_MEMBERS_43 EMBEDDED_MEMBERS_42, m42
+#define EMBEDDED_MEMBERS_44 EMBEDDED_MEMBERS_43, m43
+#define EMBEDDED_MEMBERS_45 EMBEDDED_MEMBERS_44, m44
+#define EMBEDDED_MEMBERS_46 EMBEDDED_MEMBERS_45, m45
+#define EMBEDDED_MEMBERS_47 EMBEDDED_MEMBERS_46, m46
+#define EMBEDDED_MEMBERS_48 EMBEDDED_MEMBERS_47, m47
+#define EMBEDDED_MEMBERS_49 EMBEDDED_MEMBERS_48, m48
+#define EMBEDDED_MEMBERS_50 EMBEDDED_MEMBERS_49, m49
+#define EMBEDDED_MEMBERS_51 EMBEDDED_MEMBERS_50, m50
+#define EMBEDDED_MEMBERS_52 EMBEDDED_MEMBERS_51, m51
+#define EMBEDDED_MEMBERS_53 EMBEDDED_MEMBERS_52, m52
+#define EMBEDDED_MEMBERS_54 EMBEDDED_MEMBERS_53, m53
+#define EMBEDDED_MEMBERS_55 EMBEDDED_MEMBERS_54, m54
+#define EMBEDDED_MEMBERS_56 EMBEDDED_MEMBERS_55, m55
+#define EMBEDDED_MEMBERS_57 EMBEDDED_MEMBERS_56, m56
+#define EMBEDDED_MEMBERS_58 EMBEDDED_MEMBERS_57, m57
+#define EMBEDDED_MEMBERS_59 EMBEDDED_MEMBERS_58, m58
+#define EMBEDDED_MEMBERS_60 EMBEDDED_MEMBERS_59, m59
+#define EMBEDDED_MEMBERS_61 EMBEDDED_MEMBERS_60, m60
+#define EMBEDDED_MEMBERS_62 EMBEDDED_MEMBERS_61, m61
+#define EMBEDDED_MEMBERS_63 EMBEDDED_MEMBERS_62, m62
+#define EMBEDDED_MEMBERS_64 EMBEDDED_MEMBERS_63, m63
+
+/**
+ * @brief Defines the member_binder<> specialization for an aggregate with count members.
+ * @param count Number of members, 1 to 64.
+ */
+#define EMBEDDED_MEMBER_BINDER(count)                                                                        \
+        template<>                                                                                           \
+        struct member_binder<count> final {                                                                  \
+            template<typename T, typename F>                                                                 \
+            static constexpr void visit(T& obj, F& f){                                                       \
+              auto& [EMBEDDED_MEMBERS_##count] = obj;                                                        \
+              visit_each(f, EMBEDDED_MEMBERS_##count);                                                       \
+            }                                                                                                \
+        };
+
+        EMBEDDED_MEMBER_BINDER(1) EMBEDDED_MEMBER_BINDER(2) EMBEDDED_MEMBER_BINDER(3) EMBEDDED_MEMBER_BINDER(4)
+        EMBEDDED_MEMBER_BINDER(5) EMBEDDED_MEMBER_BINDER(6) EMBEDDED_MEMBER_BINDER(7) EMBEDDED_MEMBER_BINDER(8)
+        EMBEDDED_MEMBER_BINDER(9) EMBEDDED_MEMBER_BINDER(10) EMBEDDED_MEMBER_BINDER(11) EMBEDDED_MEMBER_BINDER(12)
+        EMBEDDED_MEMBER_BINDER(13) EMBEDDED_MEMBER_BINDER(14) EMBEDDED_MEMBER_BINDER(15) EMBEDDED_MEMBER_BINDER(16)
+        EMBEDDED_MEMBER_BINDER(17) EMBEDDED_MEMBER_BINDER(18) EMBEDDED_MEMBER_BINDER(19) EMBEDDED_MEMBER_BINDER(20)
+        EMBEDDED_MEMBER_BINDER(21) EMBEDDED_MEMBER_BINDER(22) EMBEDDED_MEMBER_BINDER(23) EMBEDDED_MEMBER_BINDER(24)
+        EMBEDDED_MEMBER_BINDER(25) EMBEDDED_MEMBER_BINDER(26) EMBEDDED_MEMBER_BINDER(27) EMBEDDED_MEMBER_BINDER(28)
+        EMBEDDED_MEMBER_BINDER(29) EMBEDDED_MEMBER_BINDER(30) EMBEDDED_MEMBER_BINDER(31) EMBEDDED_MEMBER_BINDER(32)
+        EMBEDDED_MEMBER_BINDER(33) EMBEDDED_MEMBER_BINDER(34) EMBEDDED_MEMBER_BINDER(35) EMBEDDED_MEMBER_BINDER(36)
+        EMBEDDED_MEMBER_BINDER(37) EMBEDDED_MEMBER_BINDER(38) EMBEDDED_MEMBER_BINDER(39) EMBEDDED_MEMBER_BINDER(40)
+        EMBEDDED_MEMBER_BINDER(41) EMBEDDED_MEMBER_BINDER(42) EMBEDDED_MEMBER_BINDER(43) EMBEDDED_MEMBER_BINDER(44)
+        EMBEDDED_MEMBER_BINDER(45) EMBEDDED_MEMBER_BINDER(46) EMBEDDED_MEMBER_BINDER(47) EMBEDDED_MEMBER_BINDER(48)
+        EMBEDDED_MEMBER_BINDER(49) EMBEDDED_MEMBER_BINDER(50) EMBEDDED_MEMBER_BINDER(51) EMBEDDED_MEMBER_BINDER(52)
+        EMBEDDED_MEMBER_BINDER(53) EMBEDDED_MEMBER_BINDER(54) EMBEDDED_MEMBER_BINDER(55) EMBEDDED_MEMBER_BINDER(56)
+        EMBEDDED_MEMBER_BINDER(57) EMBEDDED_MEMBER_BINDER(58) EMBEDDED_MEMBER_BINDER(59) EMBEDDED_MEMBER_BINDER(60)
+        EMBEDDED_MEMBER_BINDER(61) EMBEDDED_MEMBER_BINDER(62) EMBEDDED_MEMBER_BINDER(63) EMBEDDED_MEMBER_BINDER(64)
+
+#undef EMBEDDED_MEMBER_BINDER
+#undef EMBEDDED_MEMBERS_1
+#undef EMBEDDED_MEMBERS_2
+#undef EMBEDDED_MEMBERS_3
+#undef EMBEDDED_MEMBERS_4
+#undef EMBEDDED_MEMBERS_5
+#undef EMBEDDED_MEMBERS_6
+#undef EMBEDDED_MEMBERS_7
+#undef EMBEDDED_MEMBERS_8
+#undef EMBEDDED_MEMBERS_9
+#undef EMBEDDED_MEMBERS_10
+#undef EMBEDDED_MEMBERS_11
+#undef EMBEDDED_MEMBERS_12
+#undef EMBEDDED_MEMBERS_13
+#undef EMBEDDED_MEMBERS_14
+#undef EMBEDDED_MEMBERS_15
+#undef EMBEDDED_MEMBERS_16
+#undef EMBEDDED_MEMBERS_17
+#undef EMBEDDED_MEMBERS_18
+#undef EMBEDDED_MEMBERS_19
+#undef EMBEDDED_MEMBERS_20
+#undef EMBEDDED_MEMBERS_21
+#undef EMBEDDED_MEMBERS_22
+#undef EMBEDDED_MEMBERS_23
+#undef EMBEDDED_MEMBERS_24
+#undef EMBEDDED_MEMBERS_25
+#undef EMBEDDED_MEMBERS_26
+#undef EMBEDDED_MEMBERS_27
+#undef EMBEDDED_MEMBERS_28
+#undef EMBEDDED_MEMBERS_29
+#undef EMBEDDED_MEMBERS_30
+#undef EMBEDDED_MEMBERS_31
+#undef EMBEDDED_MEMBERS_32
+#undef EMBEDDED_MEMBERS_33
+#undef EMBEDDED_MEMBERS_34
+#undef EMBEDDED_MEMBERS_35
+#undef EMBEDDED_MEMBERS_36
+#undef EMBEDDED_MEMBERS_37
+#undef EMBEDDED_MEMBERS_38
+#undef EMBEDDED_MEMBERS_39
+#undef EMBEDDED_MEMBERS_40
+#undef EMBEDDED_MEMBERS_41
+#undef EMBEDDED_MEMBERS_42
+#undef EMBEDDED_MEMBERS_43
+#undef EMBEDDED_MEMBERS_44
+#undef EMBEDDED_MEMBERS_45
+#undef EMBEDDED_MEMBERS_46
+#undef EMBEDDED_MEMBERS_47
+#undef EMBEDDED_MEMBERS_48
+#undef EMBEDDED_MEMBERS_49
+#undef EMBEDDED_MEMBERS_50
+#undef EMBEDDED_MEMBERS_51
+#undef EMBEDDED_MEMBERS_52
+#undef EMBEDDED_MEMBERS_53
+#undef EMBEDDED_MEMBERS_54
+#undef EMBEDDED_MEMBERS_55
+#undef EMBEDDED_MEMBERS_56
+#undef EMBEDDED_MEMBERS_57
+#undef EMBEDDED_MEMBERS_58
+#undef EMBEDDED_MEMBERS_59
+#undef EMBEDDED_MEMBERS_60
+#undef EMBEDDED_MEMBERS_61
+#undef EMBEDDED_MEMBERS_62
+#undef EMBEDDED_MEMBERS_63
+#undef EMBEDDED_MEMBERS_64
+    }
+
+    /**
+     * @brief Maximum number of members supported by for_each_member().
+     */
+    inline constexpr std::size_t max_aggregate_members = 64;
+
+    /**
+     * @brief Number of members of an aggregate.
+     * @tparam T Aggregate type, must not have C array members.
+     */
+    template<typename T>
+    requires std::is_aggregate_v<T>
+    inline constexpr std::size_t aggregate_member_count_v = details::aggregate_member_count<T>();
+
+    /**
+     * @brief Calls f with each member of an aggregate, in declaration order.
+     * @tparam T Aggregate type, must not have C array members or base classes.
+     * @tparam F Callable type, called with a reference to each member.
+     * @param obj [in] Aggregate object.
+     * @param f [in] Callable object.
+     * @details
+     * The members are bound with a structured binding, the calls are unrolled at compile time. Supports aggregates with
+     * up to max_aggregate_members members.
+     */
+    template<typename T, typename F>
+    requires std::is_aggregate_v<std::remove_cv_t<T>>
+    constexpr void for_each_member(T& obj, F&& f){
+      constexpr auto count = aggregate_member_count_v<std::remove_cv_t<T>>;
+      static_assert(count <= max_aggregate_members, "Aggregate has too many members.");
+      details::member_binder<count>::visit(obj, f);
+    }
 }
 
 #endif //EMBEDDED_TEMPLATE_LIBRARY_EMBEDDED_UTILITIES_HPP
@@ -0,0 +1,88 @@
+/**
+ * @file embedded_wait.hpp
+ * @date 2024-10-15
+ * @author Robert Morley
+ *
+ * @brief Embedded Template Library : Register polling backoff and counter policies header file.
+ *
+ * @version v0.1.0
+ * @copyright Copyright (c) 2024
+ */
+#ifndef EMBEDDED_TL_EMBEDDED_WAIT_HPP
+#define EMBEDDED_TL_EMBEDDED_WAIT_HPP
+
+#if __has_include(<thread>)
+#include <thread>
+#endif
+
+#include <embedded_types.hpp>
+#include <embedded_concepts.hpp>
+
+namespace embtl::wait {
+
+    /**
+     * @brief Backoff policy : pure spin, the register is read again immediately.
+     */
+    struct spin final {
+      public:
+        static constexpr void backoff([[maybe_unused]] const std::size_t iteration) noexcept { }
+    };
+    static_assert(wait_backoff_policy<spin>);
+
+    /**
+     * @brief Backoff policy : exponential spin, waits 2^iteration loops between reads, at most 2^MaxShift loops.
+     * @tparam MaxShift Maximum shift of the wait loop count.
+     */
+    template<std::size_t MaxShift = 8>
+    requires (MaxShift < 32)
+    struct exponential_spin final {
+      public:
+        static void backoff(const std::size_t iteration) noexcept {
+          const auto loops = std::size_t { 1 } << (iteration < MaxShift ? iteration : MaxShift);
+
+          for(std::size_t i = 0; i < loops; ++i){
+            asm volatile ("" ::: "memory");
+          }
+        }
+    };
+    static_assert(wait_backoff_policy<exponential_spin<>>);
+
+    /**
+     * @brief Backoff policy : wait for event (WFE) between reads, the core sleeps until an event or interrupt.
+     * @note On the host build WFE is not executed, same as spin.
+     */
+    struct wfe final {
+      public:
+        static void backoff([[maybe_unused]] const std::size_t iteration) noexcept {
+#if defined(__ARM_ARCH) && !defined(UNIT_TEST)
+          asm volatile ("wfe" ::: "memory");
+#endif
+        }
+    };
+    static_assert(wait_backoff_policy<wfe>);
+
+#if __has_include(<thread>)
+    /**
+     * @brief Backoff policy : yields the thread between reads, for RTOS or host builds.
+     */
+    struct yield final {
+      public:
+        static void backoff([[maybe_unused]] const std::size_t iteration) noexcept {
+          std::this_thread::yield();
+        }
+    };
+    static_assert(wait_backoff_policy<yield>);
+#endif
+
+    /**
+     * @brief Counter policy : no measurement.
+     */
+    struct no_counter final {
+      public:
+        static constexpr std::uint32_t now() noexcept { return 0; }
+        static constexpr void record([[maybe_unused]] const std::size_t iterations, [[maybe_unused]] const std::uint32_t cycles) noexcept { }
+    };
+    static_assert(wait_counter_policy<no_counter>);
+}
+
+#endif //EMBEDDED_TL_EMBEDDED_WAIT_HPP
@@ -21,6 +21,7 @@ CATCH_REGISTER_ENUM(embtl::STATUS,
   embtl::STATUS::INVALID_PARAMETER,
   embtl::STATUS::OUT_OF_RANGE,
   embtl::STATUS::UNINITIALIZED,
+  embtl::STATUS::TIMEOUT,
   embtl::STATUS::OK,
   embtl::STATUS::BUSY,
   embtl::STATUS::INITIALIZED
@@ -0,0 +1,103 @@
+/**
+ * @file bm_embedded_allocator.cpp
+ * @date 2024-10-16
+ * @author Robert Morley
+ *
+ * @brief Benchmark for Embedded Template Library header file "embedded_allocator.hpp", device lookup of
+ *        basic_mmio_device_allocator<>() against a linear compare chain for different device list sizes.
+ *
+ * @version v1.0.0
+ * @copyright Copyright (c) 2024
+ */
+#include <uut_catch2.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <embedded_allocator.hpp>
+#include <array>
+#include <vector>
+
+namespace {
+    /**
+     * @brief Linear compare chain, reference lookup.
+     */
+    template<embtl::memory_mapped_device_info Device, embtl::memory_mapped_device_info ... DeviceList>
+    void* linear_device_allocator(const std::size_t n) noexcept {
+      if(n == Device.number){
+        return reinterpret_cast<void*>(Device.base_address);
+      } else {
+        if constexpr(sizeof...(DeviceList) > 0){
+          return linear_device_allocator<DeviceList...>(n);
+        } else {
+          return nullptr;
+        }
+      }
+    }
+
+    constexpr std::size_t bm_lookups = 4096;
+
+    /**
+     * @brief Device numbers requested by the benchmark, every device of the list in a pseudo random order.
+     */
+    template<embtl::memory_mapped_device_info ... DeviceList>
+    std::vector<std::size_t> lookup_numbers(){
+      constexpr std::array<embtl::memory_mapped_device_info, sizeof...(DeviceList)> device_list { DeviceList... };
+      std::vector<std::size_t> numbers;
+      numbers.reserve(bm_lookups);
+      std::size_t state = 0x2545'F491U;
+
+      for(std::size_t i = 0; i < bm_lookups; ++i){
+        state = state * 1103515245U + 12345U;
+        numbers.push_back(device_list[(state >> 8) % device_list.size()].number);
+      }
+      return numbers;
+    }
+
+    template<embtl::memory_mapped_device_info ... DeviceList>
+    void lookup_benchmark(const std::string& name){
+      const auto numbers = lookup_numbers<DeviceList...>();
+
+      BENCHMARK("linear chain, " + name){
+        std::uintptr_t sum = 0;
+        for(const auto n : numbers){
+          sum += reinterpret_cast<std::uintptr_t>(linear_device_allocator<DeviceList...>(n));
+        }
+        return sum;
+      };
+      BENCHMARK("device_table, " + name){
+        std::uintptr_t sum = 0;
+        for(const auto n : numbers){
+          sum += reinterpret_cast<std::uintptr_t>(embtl::basic_mmio_device_allocator<DeviceList...>(n));
+        }
+        return sum;
+      };
+    }
+}
+
+TEST_CASE("Device allocator lookup benchmark", "[.][benchmark][embtl][allocator]"){
+  SECTION("4 devices, dense"){
+    lookup_benchmark<
+    {1_uz,0x4001'3C00},{2_uz,0x4001'4000},{3_uz,0x4001'4400},{4_uz,0x4001'4800}
+    >("4 devices, dense");
+  }
+  SECTION("16 devices, dense"){
+    lookup_benchmark<
+    {0_uz,0x4002'6010},{1_uz,0x4002'6028},{2_uz,0x4002'6040},{3_uz,0x4002'6058},{4_uz,0x4002'6070},{5_uz,0x4002'6088},
+    {6_uz,0x4002'60A0},{7_uz,0x4002'60B8},{8_uz,0x4002'60D0},{9_uz,0x4002'60E8},{10_uz,0x4002'6100},
+    {11_uz,0x4002'6118},{12_uz,0x4002'6130},{13_uz,0x4002'6148},{14_uz,0x4002'6160},{15_uz,0x4002'6178}
+    >("16 devices, dense");
+  }
+  SECTION("26 devices, alpha"){
+    lookup_benchmark<
+    {'A',0x4800'0000},{'B',0x4800'0400},{'C',0x4800'0800},{'D',0x4800'0C00},{'E',0x4800'1000},{'F',0x4800'1400},
+    {'G',0x4800'1800},{'H',0x4800'1C00},{'I',0x4800'2000},{'J',0x4800'2400},{'K',0x4800'2800},{'L',0x4800'2C00},
+    {'M',0x4800'3000},{'N',0x4800'3400},{'O',0x4800'3800},{'P',0x4800'3C00},{'Q',0x4800'4000},{'R',0x4800'4400},
+    {'S',0x4800'4800},{'T',0x4800'4C00},{'U',0x4800'5000},{'V',0x4800'5400},{'W',0x4800'5800},{'X',0x4800'5C00},
+    {'Y',0x4800'6000},{'Z',0x4800'6400}
+    >("26 devices, alpha");
+  }
+  SECTION("8 devices, sparse"){
+    lookup_benchmark<
+    {1_uz,0x5000'0000},{16_uz,0x5000'1000},{100_uz,0x5000'2000},{256_uz,0x5000'3000},{1000_uz,0x5000'4000},
+    {4096_uz,0x5000'5000},{10000_uz,0x5000'6000},{65536_uz,0x5000'7000}
+    >("8 devices, sparse");
+  }
+}
@@ -0,0 +1,153 @@
+/**
+ * @file bm_embedded_register.cpp
+ * @date 2024-10-14
+ * @author Robert Morley
+ *
+ * @brief Benchmark for Embedded Template Library header file "embedded_register.hpp", register read-modify-write
+ *        access and lock policies under host thread contention.
+ *
+ * @version v1.0.0
+ * @copyright Copyright (c) 2024
+ */
+#include <uut_catch2.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <embedded_register.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using register_type = embtl::arch_type;
+
+namespace {
+    constexpr std::size_t bm_iterations = 10'000;
+    /**
+     * @brief Worker threads updating one register, the threads are started once and every run() releases all of them
+     *        for one round of read-modify-write updates, thread creation is not part of the measured time.
+     * @tparam Register Register type.
+     */
+    template<typename Register>
+    class contention_pool final {
+      public:
+        contention_pool(Register& target, const std::size_t count) : reg(target), thread_count(count) {
+          threads.reserve(count);
+          for(std::size_t t = 0; t < count; ++t){
+            threads.emplace_back([this, t](){ worker(t); });
+          }
+        }
+
+        contention_pool(const contention_pool&) = delete;
+        contention_pool& operator=(const contention_pool&) = delete;
+
+        ~contention_pool(){
+          stop.store(true, std::memory_order_relaxed);
+          round.fetch_add(1, std::memory_order_release);
+          round.notify_all();
+          for(auto& thread : threads){
+            thread.join();
+          }
+        }
+        /**
+         * @brief Runs one round of updates on all threads.
+         * @return Register value after all threads are finished.
+         */
+        register_type run(){
+          done.store(0, std::memory_order_relaxed);
+          round.fetch_add(1, std::memory_order_release);
+          round.notify_all();
+
+          for(auto finished = done.load(std::memory_order_acquire); finished != thread_count; finished = done.load(std::memory_order_acquire)){
+            done.wait(finished, std::memory_order_acquire);
+          }
+          return reg.read();
+        }
+
+      private:
+        void worker(const std::size_t t){
+          const auto pos = (t % 4) * 8;
+          const auto bit = register_type { 0x1U } << pos;
+          std::size_t seen = 0;
+
+          while(true){
+            round.wait(seen, std::memory_order_acquire);
+            seen = round.load(std::memory_order_acquire);
+            if(stop.load(std::memory_order_relaxed)){
+              return;
+            }
+            for(std::size_t i = 0; i < bm_iterations; ++i){
+              reg |= bit;
+              reg.set_field(pos + 1, 7, static_cast<register_type>(i & 0x7FU));
+              reg &= ~bit;
+            }
+            done.fetch_add(1, std::memory_order_release);
+            done.notify_one();
+          }
+        }
+
+        Register& reg;
+        const std::size_t thread_count;
+        std::vector<std::thread> threads;
+        std::atomic<std::size_t> round { 0 };
+        std::atomic<std::size_t> done { 0 };
+        std::atomic<bool> stop { false };
+    };
+}
+
+TEST_CASE("Register read-modify-write contention benchmark", "[.][benchmark][embtl][register][atomic]"){
+  using atomic_reg_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_write_atomic<register_type>, register_type>;
+  using plain_reg_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_write<register_type>, register_type>;
+
+  SECTION("Single thread baseline"){
+    plain_reg_t plain_reg { 0U };
+
+    contention_pool pool { plain_reg, 1 };
+
+    BENCHMARK("read_write policy, 1 thread"){
+      return pool.run();
+    };
+  }
+  SECTION("Atomic policy"){
+    const auto thread_count = GENERATE(as<std::size_t>{}, 1, 2, 4, 8);
+    atomic_reg_t atomic_reg { 0U };
+
+    contention_pool pool { atomic_reg, thread_count };
+
+    BENCHMARK("atomic policy, " + std::to_string(thread_count) + " threads"){
+      return pool.run();
+    };
+  }
+}
+
+namespace {
+    template<typename Lock>
+    using locked_reg_t = embtl::basic_hardware_register<
+            embtl::policy::basic_reg_read_write<register_type, std::numeric_limits<register_type>::max(), void, false, Lock>, register_type>;
+}
+
+// PRIMASK and BASEPRI locks are simulated with a global lock on the host build.
+TEST_CASE("Register lock policy contention benchmark", "[.][benchmark][embtl][register][lock]"){
+  const auto thread_count = GENERATE(as<std::size_t>{}, 1, 2, 4, 8);
+  const auto threads = std::to_string(thread_count) + " threads";
+
+  locked_reg_t<embtl::lock::primask_lock> primask_reg { 0U };
+  locked_reg_t<embtl::lock::basepri_lock<0x40>> basepri_reg { 0U };
+  locked_reg_t<embtl::lock::spin_lock<>> spin_reg { 0U };
+  locked_reg_t<embtl::lock::mutex_lock<>> mutex_reg { 0U };
+
+  contention_pool primask_pool { primask_reg, thread_count };
+  contention_pool basepri_pool { basepri_reg, thread_count };
+  contention_pool spin_pool { spin_reg, thread_count };
+  contention_pool mutex_pool { mutex_reg, thread_count };
+
+  BENCHMARK("primask_lock, " + threads){
+    return primask_pool.run();
+  };
+  BENCHMARK("basepri_lock, " + threads){
+    return basepri_pool.run();
+  };
+  BENCHMARK("spin_lock, " + threads){
+    return spin_pool.run();
+  };
+  BENCHMARK("mutex_lock, " + threads){
+    return mutex_pool.run();
+  };
+}
@@ -0,0 +1,233 @@
+/**
+ * @file bm_embedded_ring.cpp
+ * @date 2024-10-17
+ * @author Robert Morley
+ *
+ * @brief Benchmark for Embedded Template Library header file "embedded_ring.hpp", producer/consumer threads through
+ *        basic_spsc_ring<> against a mutex protected ring buffer: throughput in items/s and item latency percentiles;
+ *        1 to 16 producer and consumer threads through basic_mpmc_queue<> against the same mutex ring.
+ *
+ * @version v1.0.0
+ * @copyright Copyright (c) 2024
+ */
+#include <uut_catch2.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <embedded_ring.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    using bm_clock = std::chrono::steady_clock;
+
+    constexpr std::size_t bm_items = 1U << 18;
+    constexpr std::size_t bm_capacity = 1024;
+    constexpr std::size_t bm_burst = 16;
+    constexpr std::size_t bm_mpmc_items = 1U << 16;
+    constexpr std::size_t bm_mpmc_capacity = 256;
+
+    /**
+     * @brief Reference ring buffer, every access under a lock (the interrupt disable of a driver ring).
+     */
+    template<typename T, std::size_t N>
+    class mutex_ring final {
+      public:
+        bool push(const T& value){
+          const std::lock_guard<std::mutex> guard(lock);
+          if(count == N){
+            return false;
+          }
+          buffer[(first + count++) % N] = value;
+          return true;
+        }
+
+        std::size_t push_n(const std::span<const T> values){
+          std::size_t n = 0;
+          while(n < values.size() && push(values[n])){
+            ++n;
+          }
+          return n;
+        }
+
+        bool pop(T& value){
+          const std::lock_guard<std::mutex> guard(lock);
+          if(count == 0){
+            return false;
+          }
+          value = buffer[first];
+          first = (first + 1) % N;
+          --count;
+          return true;
+        }
+
+        std::size_t pop_n(const std::span<T> values){
+          std::size_t n = 0;
+          while(n < values.size() && pop(values[n])){
+            ++n;
+          }
+          return n;
+        }
+
+      private:
+        std::mutex lock;
+        std::array<T, N> buffer { };
+        std::size_t first = 0;
+        std::size_t count = 0;
+    };
+
+    /**
+     * @brief Item timestamp, written by the producer when the item is pushed.
+     */
+    struct stamped_item {
+        std::int64_t pushed_ns;
+    };
+
+    std::int64_t now_ns() noexcept {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(bm_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * @brief Moves bm_items items from a producer thread to the calling thread, in bursts.
+     * @return Latency of each item in nanoseconds, push to pop.
+     */
+    template<typename Ring>
+    std::vector<std::int64_t> transfer(Ring& ring, const bool record){
+      std::vector<std::int64_t> latency;
+      if(record){
+        latency.reserve(bm_items);
+      }
+
+      std::thread producer([&ring](){
+        std::array<stamped_item, bm_burst> burst { };
+        std::size_t sent = 0;
+        while(sent < bm_items){
+          const auto n = std::min(bm_burst, bm_items - sent);
+          const auto stamp = now_ns();
+          for(std::size_t i = 0; i < n; ++i){
+            burst[i].pushed_ns = stamp;
+          }
+          std::size_t pushed = 0;
+          while(pushed < n){
+            const auto k = ring.push_n(std::span<const stamped_item>(burst).subspan(pushed, n - pushed));
+            if(k == 0){
+              std::this_thread::yield();
+            }
+            pushed += k;
+          }
+          sent += n;
+        }
+      });
+
+      std::array<stamped_item, bm_burst> batch { };
+      std::size_t received = 0;
+      while(received < bm_items){
+        const auto n = ring.pop_n(batch);
+        if(n == 0){
+          std::this_thread::yield();
+          continue;
+        }
+        if(record){
+          const auto stamp = now_ns();
+          for(std::size_t i = 0; i < n; ++i){
+            latency.push_back(stamp - batch[i].pushed_ns);
+          }
+        }
+        received += n;
+      }
+      producer.join();
+      return latency;
+    }
+
+    template<typename Ring>
+    void report_latency(const std::string& name){
+      Ring ring;
+      const auto start = bm_clock::now();
+      auto latency = transfer(ring, true);
+      const std::chrono::duration<double> elapsed = bm_clock::now() - start;
+
+      std::sort(latency.begin(), latency.end());
+      auto percentile = [&latency](const double p){
+        return latency[static_cast<std::size_t>(p * static_cast<double>(latency.size() - 1))];
+      };
+      WARN(name << " : " << static_cast<double>(bm_items) / elapsed.count() << " items/s, latency ns p50 "
+                << percentile(0.5) << ", p99 " << percentile(0.99) << ", p99.9 " << percentile(0.999)
+                << ", max " << latency.back());
+    }
+
+    /**
+     * @brief Moves bm_mpmc_items items from producer threads to as many consumer threads, one item per call.
+     * @return Number of items received.
+     */
+    template<typename Queue>
+    std::size_t fan_in(Queue& queue, const std::size_t threads){
+      std::atomic<std::size_t> received { 0 };
+      std::vector<std::thread> workers;
+      workers.reserve(2 * threads);
+
+      for(std::size_t producer = 0; producer < threads; ++producer){
+        const auto count = bm_mpmc_items / threads + (producer < bm_mpmc_items % threads ? 1 : 0);
+        workers.emplace_back([&queue, count](){
+          const stamped_item item { 0 };
+          for(std::size_t sent = 0; sent < count; ){
+            if(queue.push(item)){
+              ++sent;
+            } else {
+              std::this_thread::yield();
+            }
+          }
+        });
+      }
+      for(std::size_t consumer = 0; consumer < threads; ++consumer){
+        workers.emplace_back([&queue, &received](){
+          stamped_item item { };
+          while(received.load(std::memory_order_relaxed) < bm_mpmc_items){
+            if(queue.pop(item)){
+              received.fetch_add(1, std::memory_order_relaxed);
+            } else {
+              std::this_thread::yield();
+            }
+          }
+        });
+      }
+      for(auto& worker : workers){
+        worker.join();
+      }
+      return received.load();
+    }
+}
+
+TEST_CASE("SPSC ring producer/consumer benchmark", "[.][benchmark][embtl][ring]"){
+  SECTION("Throughput"){
+    BENCHMARK_ADVANCED("basic_spsc_ring, 2^18 items")(Catch::Benchmark::Chronometer meter){
+      embtl::basic_spsc_ring<stamped_item, bm_capacity> ring;
+      meter.measure([&ring](){ return transfer(ring, false).size(); });
+    };
+    BENCHMARK_ADVANCED("mutex ring, 2^18 items")(Catch::Benchmark::Chronometer meter){
+      mutex_ring<stamped_item, bm_capacity> ring;
+      meter.measure([&ring](){ return transfer(ring, false).size(); });
+    };
+  }
+  SECTION("Latency"){
+    report_latency<embtl::basic_spsc_ring<stamped_item, bm_capacity>>("basic_spsc_ring");
+    report_latency<mutex_ring<stamped_item, bm_capacity>>("mutex ring");
+  }
+}
+
+TEST_CASE("MPMC queue thread scaling benchmark", "[.][benchmark][embtl][ring][mpmc]"){
+  for(const std::size_t threads : { 1U, 2U, 4U, 8U, 16U }){
+    const auto suffix = std::to_string(threads) + " producers + " + std::to_string(threads) + " consumers, 2^16 items";
+
+    BENCHMARK_ADVANCED("basic_mpmc_queue, " + suffix)(Catch::Benchmark::Chronometer meter){
+      embtl::basic_mpmc_queue<stamped_item, bm_mpmc_capacity> queue;
+      meter.measure([&queue, threads](){ return fan_in(queue, threads); });
+    };
+    BENCHMARK_ADVANCED("mutex ring, " + suffix)(Catch::Benchmark::Chronometer meter){
+      mutex_ring<stamped_item, bm_mpmc_capacity> queue;
+      meter.measure([&queue, threads](){ return fan_in(queue, threads); });
+    };
+  }
+}
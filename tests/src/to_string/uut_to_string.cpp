@@ -22,6 +22,7 @@ std::ostream& embtl::operator<<(std::ostream& os, const STATUS& status) noexcept
     case STATUS::INVALID_PARAMETER  : status_str = "INVALID_PARAMETER"; break;
     case STATUS::OUT_OF_RANGE       : status_str = "OUT_OF_RANGE"; break;
     case STATUS::UNINITIALIZED      : status_str = "UNINITIALIZED"; break;
+    case STATUS::TIMEOUT            : status_str = "TIMEOUT"; break;
     case STATUS::OK                 : status_str = "OK"; break;
     case STATUS::BUSY               : status_str = "BUSY"; break;
     case STATUS::INITIALIZED        : status_str = "INITIALIZED"; break;
@@ -9,6 +9,9 @@
  * @copyright Copyright (c) 2024
  */
 #include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
 #include <uut_catch2.hpp>
 #include <embedded_allocator.hpp>
 
@@ -135,6 +138,99 @@ TEMPLATE_TEST_CASE_SIG("template basic_mmio_device_list_allocator<> unit test","
   }
 }
 
+/**
+ * @brief Unit Test for basic_mmio_device_list_allocator<> device claims.
+ */
+TEMPLATE_TEST_CASE_SIG("template basic_mmio_device_list_allocator<> claim test","[embtl][template][struct][claim]",
+                       ((bool HostAlloc, embtl::memory_mapped_device_info ... DeviceList), HostAlloc, DeviceList ...),
+                       (false, {1_uz,0x4800'0000},{2_uz,0x4800'0400},{3_uz,0x4800'0800}),
+                       (true, {'A',0x4800'0000},{'B',0x4800'0400},{'C',0x4800'0000}),
+                       (true, {1_uz,0x5000'0000},{100_uz,0x5000'1000},{1000_uz,0x5000'2000},{65536_uz,0x5000'3000})
+){
+  using dev_alloc = embtl::basic_mmio_device_list_allocator<std::bool_constant<HostAlloc>, DeviceList...>;
+  constexpr std::array<embtl::memory_mapped_device_info, sizeof...(DeviceList)> device_list { DeviceList... };
+
+  SECTION("allocate() claims, deallocate() releases"){
+    for(auto& device : device_list){
+      CAPTURE(device.number);
+      auto* reg_ptr = dev_alloc::allocate(4_uz, device.number);
+      REQUIRE_FALSE(reg_ptr == nullptr);
+      REQUIRE(dev_alloc::is_claimed(device.number));
+      REQUIRE(dev_alloc::allocate(4_uz, device.number) == nullptr);
+      REQUIRE(dev_alloc::claim(device.number) == embtl::STATUS::NOT_AVAILABLE);
+
+      dev_alloc::deallocate(reg_ptr);
+      REQUIRE_FALSE(dev_alloc::is_claimed(device.number));
+      REQUIRE(dev_alloc::allocate(4_uz, device.number) == reg_ptr);
+      dev_alloc::deallocate(reg_ptr);
+    }
+  }
+  SECTION("Devices are claimed independently"){
+    std::vector<void*> taken;
+    for(auto& device : device_list){
+      taken.push_back(dev_alloc::allocate(4_uz, device.number));
+      REQUIRE_FALSE(taken.back() == nullptr);
+    }
+    for(std::size_t i = 0; i < device_list.size(); ++i){
+      dev_alloc::release(device_list[i].number);
+      for(std::size_t j = 0; j < device_list.size(); ++j){
+        REQUIRE(dev_alloc::is_claimed(device_list[j].number) == (j > i));
+      }
+    }
+  }
+  SECTION("claim() and release()"){
+    REQUIRE(dev_alloc::claim(device_list[0].number) == embtl::STATUS::OK);
+    REQUIRE(dev_alloc::allocate(4_uz, device_list[0].number) == nullptr);
+    dev_alloc::release(device_list[0].number);
+    REQUIRE(dev_alloc::claim(device_list[0].number) == embtl::STATUS::OK);
+    dev_alloc::release(device_list[0].number);
+
+    REQUIRE(dev_alloc::claim(12345_uz) == embtl::STATUS::INVALID_PARAMETER);
+    REQUIRE(dev_alloc::allocate(4_uz, 12345_uz) == nullptr);
+    REQUIRE_FALSE(dev_alloc::is_claimed(12345_uz));
+    dev_alloc::deallocate(nullptr);
+  }
+}
+
+/**
+ * @brief Multiple threads race to claim the same devices, each device has one owner.
+ */
+TEST_CASE("template basic_mmio_device_list_allocator<> claim thread test","[embtl][template][struct][claim][thread]"){
+  using dev_alloc = embtl::basic_mmio_device_list_allocator<std::true_type,
+          {0_uz,0x4000'0000},{1_uz,0x4000'0400},{2_uz,0x4000'0800},{3_uz,0x4000'0C00},
+          {4_uz,0x4000'1000},{5_uz,0x4000'1400},{6_uz,0x4000'1800},{7_uz,0x4000'1C00}>;
+
+  constexpr std::size_t device_count = 8;
+  constexpr std::size_t thread_count = 8;
+  constexpr std::size_t rounds = 200;
+
+  for(std::size_t round = 0; round < rounds; ++round){
+    std::array<std::atomic<std::size_t>, device_count> owners { };
+    std::atomic<bool> start { false };
+    std::vector<std::thread> threads;
+
+    for(std::size_t id = 0; id < thread_count; ++id){
+      threads.emplace_back([&owners, &start](){
+        while(!start.load(std::memory_order_acquire)){ }
+        for(std::size_t n = 0; n < device_count; ++n){
+          if(dev_alloc::allocate(4_uz, n) != nullptr){
+            owners[n].fetch_add(1, std::memory_order_relaxed);
+          }
+        }
+      });
+    }
+    start.store(true, std::memory_order_release);
+    for(auto& thread : threads){
+      thread.join();
+    }
+
+    for(std::size_t n = 0; n < device_count; ++n){
+      REQUIRE(owners[n].load() == 1);
+      dev_alloc::release(n);
+    }
+  }
+}
+
 /**
  * @brief Unit Test for basic_mmio_single_device_allocator<> template struct.
  */
@@ -162,3 +258,358 @@ TEMPLATE_TEST_CASE_SIG("template basic_mmio_single_device_allocator<> unit test"
   }
 
 }
+
+/**
+ * @brief Unit Test for details::host_arena<> template struct.
+ */
+TEMPLATE_TEST_CASE_SIG("template host_arena<> unit test","[embtl][template][struct][host_arena]",
+                       ((bool Mirrored, embtl::memory_mapped_device_info ... DeviceList), Mirrored, DeviceList ...),
+                       (true, {0x4000'0000}),
+                       (true, {'A',0x4800'0000},{'B',0x4800'0400},{'H',0x4800'1C00}),
+                       (true, {3_uz,0x4002'6C00},{1_uz,0x4002'6400},{2_uz,0x4002'6800}),
+                       (false, {1_uz,0x4000'0000},{2_uz,0x4002'0000}),
+                       (false, {1_uz,0x6000'0000},{2_uz,0x6000'5000},{3_uz,0x6000'7000},{4_uz,0x6000'9000},{5_uz,0x4000'A000})
+){
+  using arena_t = embtl::details::host_arena<DeviceList...>;
+  constexpr std::array<embtl::memory_mapped_device_info, sizeof...(DeviceList)> device_list { DeviceList... };
+
+  STATIC_REQUIRE(arena_t::mirrored == Mirrored);
+
+  SECTION("Relative offsets"){
+    for(auto& device : device_list){
+      auto* reg_ptr = static_cast<std::byte*>(arena_t::allocate(4_uz, device.number));
+      CAPTURE(device.number, device.base_address);
+      REQUIRE_FALSE(reg_ptr == nullptr);
+      REQUIRE(reinterpret_cast<std::uintptr_t>(reg_ptr) % alignof(embtl::arch_type) == 0);
+
+      for(auto& other : device_list){
+        auto* other_ptr = static_cast<std::byte*>(arena_t::allocate(4_uz, other.number));
+        if constexpr (Mirrored){
+          REQUIRE(other_ptr - reg_ptr == static_cast<std::ptrdiff_t>(other.base_address) - static_cast<std::ptrdiff_t>(device.base_address));
+        } else {
+          REQUIRE((other_ptr < reg_ptr) == (other.base_address < device.base_address));
+          REQUIRE((other_ptr == reg_ptr) == (other.base_address == device.base_address));
+        }
+      }
+    }
+  }
+  SECTION("Same registers for every allocation"){
+    for(auto& device : device_list){
+      auto* first = static_cast<embtl::arch_type*>(arena_t::allocate(sizeof(embtl::arch_type), device.number));
+      *first = static_cast<embtl::arch_type>(device.number + 1);
+      auto* second = static_cast<embtl::arch_type*>(arena_t::allocate(sizeof(embtl::arch_type), device.number));
+
+      REQUIRE(first == second);
+      REQUIRE(*second == static_cast<embtl::arch_type>(device.number + 1));
+    }
+  }
+  SECTION("Invalid requests"){
+    REQUIRE(arena_t::allocate(4_uz, 25_uz) == nullptr);
+    REQUIRE(arena_t::allocate(arena_t::size + 1, device_list[0].number) == nullptr);
+  }
+}
+
+namespace {
+    struct large_registers_t {
+        std::array<embtl::arch_type, 0x1800 / sizeof(embtl::arch_type)> words;
+    };
+}
+
+/**
+ * @brief Unit Test for details::host_arena<> with register maps larger than the default host arena region.
+ */
+TEST_CASE("template host_arena<> large register map unit test","[embtl][template][struct][host_arena]"){
+  STATIC_REQUIRE(sizeof(large_registers_t) > embtl::details::host_arena_region_size);
+
+  SECTION("Single device"){
+    using default_alloc_t = embtl::basic_mmio_single_device_allocator<{0x4000'0000}, std::true_type>;
+    using sized_alloc_t = embtl::basic_mmio_single_device_allocator<{0_uz, 0x4001'0000, sizeof(large_registers_t)}, std::true_type>;
+
+    REQUIRE(default_alloc_t::allocate(sizeof(large_registers_t)) == nullptr);
+
+    auto* regs = static_cast<large_registers_t*>(sized_alloc_t::allocate(sizeof(large_registers_t)));
+    REQUIRE_FALSE(regs == nullptr);
+    regs->words.back() = 0xA5A5'A5A5U;
+    REQUIRE(regs->words.back() == 0xA5A5'A5A5U);
+  }
+  SECTION("Highest address device, mirrored"){
+    using arena_t = embtl::details::host_arena<{1_uz, 0x5000'0000}, {2_uz, 0x5000'1000, sizeof(large_registers_t)}>;
+
+    STATIC_REQUIRE(arena_t::mirrored);
+    STATIC_REQUIRE(arena_t::size == 0x1000 + sizeof(large_registers_t));
+    REQUIRE_FALSE(arena_t::allocate(sizeof(large_registers_t), 2_uz) == nullptr);
+  }
+  SECTION("Packed devices"){
+    using arena_t = embtl::details::host_arena<{1_uz, 0x1000'0000, sizeof(large_registers_t)}, {2_uz, 0x9000'0000}>;
+
+    STATIC_REQUIRE_FALSE(arena_t::mirrored);
+    STATIC_REQUIRE(arena_t::slot_size == 0x2000);
+
+    auto* first = static_cast<std::byte*>(arena_t::allocate(sizeof(large_registers_t), 1_uz));
+    auto* second = static_cast<std::byte*>(arena_t::allocate(sizeof(large_registers_t), 2_uz));
+    REQUIRE_FALSE(first == nullptr);
+    REQUIRE_FALSE(second == nullptr);
+    REQUIRE(second - first == 0x2000);
+  }
+}
+
+/**
+ * @brief Unit Test for device_table<> template alias.
+ */
+TEMPLATE_TEST_CASE_SIG("template device_table<> unit test","[embtl][template][struct]",
+                       ((bool Dense, embtl::memory_mapped_device_info ... DeviceList), Dense, DeviceList ...),
+                       (true, {0x4000'0000}),
+                       (true, {'A',0x4800'0000},{'B',0x4800'0400},{'H',0x4800'1C00}),
+                       (true, {3_uz,0x4002'6000},{1_uz,0x4002'6400},{2_uz,0x4002'6800},{3_uz,0x4002'6C00}),
+                       (false, {1_uz,0x5000'0000},{100_uz,0x5000'1000},{1000_uz,0x5000'2000},{65536_uz,0x5000'3000}),
+                       (false, {7_uz,0x6000'0000},{70_uz,0x6000'1000},{700_uz,0x6000'2000},{7000_uz,0x6000'3000},{70000_uz,0x6000'4000})
+){
+  using table_t = embtl::device_table<DeviceList...>;
+  constexpr std::array<embtl::memory_mapped_device_info, sizeof...(DeviceList)> device_list { DeviceList... };
+
+  STATIC_REQUIRE(std::is_same_v<table_t, embtl::details::dense_device_table<DeviceList...>> == Dense);
+
+  for(auto& device : device_list){
+    CAPTURE(device.number, device.base_address);
+    // first entry of a device number is used, same as a linear search.
+    REQUIRE(table_t::find(device.number) == std::find_if(device_list.begin(), device_list.end(),
+                                                          [&device](const auto& item){ return item.number == device.number; })->base_address);
+  }
+
+  auto missing = GENERATE(take(100, random(0_uz, 100'000_uz)));
+  const auto is_device = std::any_of(device_list.begin(), device_list.end(), [missing](const auto& item){ return item.number == missing; });
+  if(!is_device){
+    REQUIRE(table_t::find(missing) == 0);
+    REQUIRE(embtl::basic_mmio_device_allocator<DeviceList...>(missing) == nullptr);
+  }
+}
+
+namespace {
+    struct pool_message_t {
+        std::uint32_t owner;
+        std::uint32_t sequence;
+        std::uint64_t payload;
+    };
+
+    struct pool_stress_t {
+        std::uint32_t owner;
+        std::uint32_t sequence;
+    };
+}
+
+/**
+ * @brief Unit Test for details::interrupt_safe_word<>, atomic and critical section variants.
+ */
+TEMPLATE_TEST_CASE_SIG("template interrupt_safe_word<> unit test","[embtl][template][struct][claim]",
+                       ((bool LockFree), LockFree),
+                       (true),
+                       (false)
+){
+  using word_t = embtl::details::interrupt_safe_word<std::uintptr_t, LockFree>;
+
+  SECTION("Operations"){
+    word_t word { 0x10 };
+    REQUIRE(word.load(std::memory_order_relaxed) == 0x10);
+    REQUIRE(word.fetch_or(0x03, std::memory_order_acquire) == 0x10);
+    REQUIRE(word.fetch_and(~std::uintptr_t{0x01}, std::memory_order_release) == 0x13);
+    REQUIRE(word.load(std::memory_order_acquire) == 0x12);
+
+    std::uintptr_t expected = 0x11;
+    REQUIRE_FALSE(word.compare_exchange_weak(expected, 0x20, std::memory_order_acquire, std::memory_order_relaxed));
+    REQUIRE(expected == 0x12);
+    while(!word.compare_exchange_weak(expected, 0x20, std::memory_order_acquire, std::memory_order_relaxed)){ }
+    word.store(word.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    REQUIRE(word.load(std::memory_order_acquire) == 0x21);
+  }
+  SECTION("Concurrent bits"){
+    constexpr std::size_t thread_count = 8;
+    constexpr std::size_t iterations = 10'000;
+    static word_t bits { };
+    std::atomic<std::size_t> lost { 0 };
+
+    std::vector<std::thread> threads;
+    for(std::size_t t = 0; t < thread_count; ++t){
+      threads.emplace_back([&lost, t](){
+        const auto mask = std::uintptr_t{1} << t;
+        for(std::size_t i = 0; i < iterations; ++i){
+          if((bits.fetch_or(mask, std::memory_order_acquire) & mask) != 0 ||
+             (bits.fetch_and(~mask, std::memory_order_release) & mask) == 0){
+            lost.fetch_add(1, std::memory_order_relaxed);
+          }
+        }
+      });
+    }
+    for(auto& thread : threads){
+      thread.join();
+    }
+
+    REQUIRE(lost.load() == 0);
+    REQUIRE(bits.load(std::memory_order_acquire) == 0);
+  }
+}
+
+/**
+ * @brief Unit Test for basic_pool_allocator<> template struct.
+ */
+TEST_CASE("template basic_pool_allocator<> unit test","[embtl][template][struct][pool]"){
+  using pool_t = embtl::basic_pool_allocator<pool_message_t, 8>;
+
+  STATIC_REQUIRE(pool_t::capacity() == 8);
+  STATIC_REQUIRE(embtl::mmio_allocator<pool_t>);
+
+  std::vector<void*> taken;
+  for(std::size_t i = 0; i < pool_t::capacity(); ++i){
+    auto* ptr = pool_t::allocate(sizeof(pool_message_t));
+    REQUIRE_FALSE(ptr == nullptr);
+    REQUIRE(pool_t::owns(ptr));
+    REQUIRE(reinterpret_cast<std::uintptr_t>(ptr) % alignof(pool_message_t) == 0);
+    taken.push_back(ptr);
+  }
+
+  SECTION("Exhausted pool"){
+    REQUIRE(pool_t::allocate(sizeof(pool_message_t)) == nullptr);
+  }
+  SECTION("Released slot is reused"){
+    pool_t::deallocate(taken[3]);
+    REQUIRE(pool_t::allocate(sizeof(pool_message_t)) == taken[3]);
+  }
+  SECTION("Invalid requests"){
+    pool_t::deallocate(taken[0]);
+    REQUIRE(pool_t::allocate(sizeof(pool_message_t) + 1) == nullptr);
+    REQUIRE_FALSE(pool_t::owns(nullptr));
+    REQUIRE_FALSE(pool_t::owns(static_cast<std::byte*>(taken[1]) + 1));
+    pool_t::deallocate(nullptr);
+    REQUIRE(pool_t::allocate(sizeof(pool_message_t)) == taken[0]);
+    REQUIRE(pool_t::allocate(sizeof(pool_message_t)) == nullptr);
+  }
+
+  for(auto* ptr : taken){
+    pool_t::deallocate(ptr);
+  }
+}
+
+/**
+ * @brief Multiple threads allocate, write, check and release the slots of one pool.
+ */
+TEST_CASE("template basic_pool_allocator<> thread stress test","[embtl][template][struct][pool][thread]"){
+  using pool_t = embtl::basic_pool_allocator<pool_stress_t, 16>;
+
+  constexpr std::uint32_t thread_count = 8;
+  constexpr std::uint32_t iterations = 20'000;
+
+  std::atomic<std::size_t> exhausted { 0 };
+  std::atomic<std::size_t> corrupted { 0 };
+  std::vector<std::thread> threads;
+
+  for(std::uint32_t id = 0; id < thread_count; ++id){
+    threads.emplace_back([id, &exhausted, &corrupted](){
+      std::array<pool_stress_t*, 3> held { };
+      for(std::uint32_t i = 0; i < iterations; ++i){
+        for(auto& slot : held){
+          slot = static_cast<pool_stress_t*>(pool_t::allocate(sizeof(pool_stress_t)));
+          if(slot == nullptr){
+            exhausted.fetch_add(1, std::memory_order_relaxed);
+          } else {
+            *slot = { id, i };
+          }
+        }
+        for(auto& slot : held){
+          if(slot != nullptr){
+            if(slot->owner != id || slot->sequence != i){
+              corrupted.fetch_add(1, std::memory_order_relaxed);
+            }
+            pool_t::deallocate(slot);
+          }
+        }
+      }
+    });
+  }
+  for(auto& thread : threads){
+    thread.join();
+  }
+
+  REQUIRE(corrupted.load() == 0);
+  CAPTURE(exhausted.load());
+
+  std::vector<void*> taken;
+  while(auto* ptr = pool_t::allocate(sizeof(pool_stress_t))){
+    taken.push_back(ptr);
+  }
+  std::sort(taken.begin(), taken.end());
+  REQUIRE(taken.size() == pool_t::capacity());
+  REQUIRE(std::adjacent_find(taken.begin(), taken.end()) == taken.end());
+
+  for(auto* ptr : taken){
+    pool_t::deallocate(ptr);
+  }
+}
+
+namespace {
+    struct control_state_t {
+        float gain;
+        float integral;
+        std::uint8_t mode;
+
+        control_state_t(const float g, const std::uint8_t m) noexcept : gain(g), integral(0.0F), mode(m) { }
+    };
+
+    struct filter_state_t {
+        std::uint64_t history[4];
+    };
+
+    using dma_buffer_t = embtl::aligned_buffer<std::uint16_t, 64, 64>;
+
+    EMBEDDED_MEMORY_SECTION(fast_section_t, ".dtcm", 256, 16, std::uint8_t, control_state_t, filter_state_t);
+    EMBEDDED_MEMORY_SECTION(dma_section_t, ".dma_nocache", 512, 64, dma_buffer_t, std::uint32_t);
+}
+
+/**
+ * @brief Unit Test for basic_section_allocator<> template struct.
+ */
+TEST_CASE("template basic_section_allocator<> unit test","[embtl][template][struct][section]"){
+  using fast_alloc_t = embtl::basic_section_allocator<fast_section_t>;
+  using dma_alloc_t = embtl::basic_section_allocator<dma_section_t>;
+
+  STATIC_REQUIRE(embtl::memory_section<fast_section_t>);
+  STATIC_REQUIRE(fast_alloc_t::offset<std::uint8_t>() == 0);
+  STATIC_REQUIRE(fast_alloc_t::offset<control_state_t>() == alignof(control_state_t));
+  STATIC_REQUIRE(fast_alloc_t::offset<filter_state_t>() % alignof(filter_state_t) == 0);
+  STATIC_REQUIRE(fast_alloc_t::used == fast_alloc_t::offset<filter_state_t>() + sizeof(filter_state_t));
+  STATIC_REQUIRE(fast_alloc_t::available == fast_section_t::capacity - fast_alloc_t::used);
+  STATIC_REQUIRE(alignof(dma_buffer_t) == 64);
+  STATIC_REQUIRE(dma_alloc_t::offset<std::uint32_t>() == sizeof(dma_buffer_t));
+  STATIC_REQUIRE(std::is_same_v<fast_alloc_t, embtl::basic_section_allocator<fast_section_t, fast_section_t::objects>>);
+
+  SECTION("Objects are placed in the section block"){
+    auto* block = fast_section_t::storage();
+    REQUIRE(reinterpret_cast<std::uintptr_t>(block) % fast_section_t::alignment == 0);
+    REQUIRE(static_cast<void*>(fast_alloc_t::get<std::uint8_t>()) == block);
+    REQUIRE(static_cast<void*>(fast_alloc_t::get<filter_state_t>()) == block + fast_alloc_t::offset<filter_state_t>());
+    REQUIRE(fast_alloc_t::allocate<filter_state_t>(sizeof(filter_state_t)) == fast_alloc_t::get<filter_state_t>());
+    REQUIRE(fast_alloc_t::allocate<filter_state_t>(sizeof(filter_state_t) + 1) == nullptr);
+  }
+  SECTION("Constructed objects"){
+    auto* state = fast_alloc_t::construct<control_state_t>(2.5F, std::uint8_t{3});
+    REQUIRE(state == fast_alloc_t::get<control_state_t>());
+    REQUIRE(state->gain == 2.5F);
+    REQUIRE(state->mode == 3);
+  }
+  SECTION("Separate host arenas"){
+    auto* buffer = dma_alloc_t::get<dma_buffer_t>();
+    REQUIRE(reinterpret_cast<std::uintptr_t>(buffer) % 64 == 0);
+    REQUIRE(static_cast<void*>(buffer) == dma_section_t::storage());
+    REQUIRE_FALSE(dma_section_t::storage() == fast_section_t::storage());
+
+    for(std::size_t i = 0; i < buffer->size(); ++i){
+      (*buffer)[i] = static_cast<std::uint16_t>(i);
+    }
+    *dma_alloc_t::get<std::uint32_t>() = 0xDEAD'BEEF;
+    REQUIRE((*buffer)[buffer->size() - 1] == buffer->size() - 1);
+  }
+  SECTION("Allocators of one section share the layout"){
+    using other_alloc_t = embtl::basic_section_allocator<fast_section_t>;
+    STATIC_REQUIRE(std::is_same_v<other_alloc_t, fast_alloc_t>);
+    REQUIRE(other_alloc_t::get<control_state_t>() == fast_alloc_t::get<control_state_t>());
+    REQUIRE(static_cast<void*>(other_alloc_t::get<filter_state_t>()) != static_cast<void*>(fast_alloc_t::get<std::uint8_t>()));
+  }
+}
@@ -0,0 +1,242 @@
+/**
+ * @file uut_embedded_async.cpp
+ * @date 2024-10-17
+ * @author Robert Morley
+ *
+ * @brief
+ *
+ * @version v0.1.0
+ * @copyright Copyright (c) 2024
+ */
+#include <vector>
+#include <uut_catch2.hpp>
+#include <embedded_async.hpp>
+#include <embedded_register.hpp>
+
+namespace {
+    using async_reg_rw_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_write<embtl::arch_type>>;
+    using async_reg_ro_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_only<embtl::arch_type>>;
+
+    using SPI_SR_TXE = embtl::field<1>;
+
+    struct spi_registers_t {
+        async_reg_rw_t CR;
+        async_reg_ro_t SR;
+        async_reg_rw_t DR;
+    };
+
+    using spi_region_t = embtl::basic_device_region<spi_registers_t, embtl::basic_mmio_single_device_allocator<{0x4001'3000}, std::true_type>>;
+    using host_irq_t = embtl::async::idle::host_interrupts;
+
+    /**
+     * @brief SPI driver, the transfer waits for TXE, writes DR and waits for the end of transfer interrupt.
+     */
+    struct spi_driver final : public embtl::basic_async_driver<spi_region_t, 256, 4> {
+      public:
+        task transfer(const embtl::arch_type value) {
+          if(const auto status = co_await embtl::async::reg_condition<SPI_SR_TXE>(reg_map->SR, 1); status != embtl::STATUS::OK){
+            co_return status;
+          }
+          reg_map->DR.write(value);
+          ++writes;
+          co_await transfer_done;
+          co_return embtl::STATUS::OK;
+        }
+
+        task transfer_block(const embtl::arch_type first, const std::size_t n) {
+          for(std::size_t i = 0; i < n; ++i){
+            if(const auto status = co_await transfer(first + static_cast<embtl::arch_type>(i)); status != embtl::STATUS::OK){
+              co_return status;
+            }
+          }
+          co_return embtl::STATUS::OK;
+        }
+
+        /**
+         * @brief End of transfer interrupt handler, sets TXE again and signals the transfer.
+         */
+        static void irq_handler(void* context) noexcept {
+          auto* self = static_cast<spi_driver*>(context);
+          async_reg_ro_t::set_register(self->reg_map->SR, 0x02);
+          self->transfer_done.signal();
+        }
+
+        spi_registers_t& registers() noexcept { return *reg_map; }
+
+        embtl::async::event transfer_done;
+        std::size_t writes = 0;
+    };
+
+    using event_pool_t = embtl::async::frame_pool<struct event_tag_t, 256, 2>;
+
+    embtl::async::task<event_pool_t> await_event(embtl::async::event& irq) {
+      co_return co_await irq;
+    }
+
+    /**
+     * @brief Signals irq on the second condition check, as an interrupt firing after a scheduler pass checked irq.
+     */
+    embtl::async::task<event_pool_t> interrupt_after_pass(embtl::async::event& irq, std::size_t& checks) {
+      co_return co_await embtl::async::condition_awaiter { [&irq, &checks]() noexcept {
+        if(++checks == 2){
+          irq.signal();
+        }
+        return checks > 2;
+      } };
+    }
+}
+
+TEST_CASE("async task<> frame pool test", "[embtl][template][async]"){
+  embtl::async::event irq;
+
+  SECTION("Frames come from the pool"){
+    auto first = await_event(irq);
+    auto second = await_event(irq);
+    auto third = await_event(irq);
+
+    REQUIRE_FALSE(first.has_error());
+    REQUIRE_FALSE(second.has_error());
+    REQUIRE(third.has_error());
+    REQUIRE(third.status() == embtl::STATUS::NOT_AVAILABLE);
+    REQUIRE(first.status() == embtl::STATUS::BUSY);
+  }
+  SECTION("Destroyed tasks return their frame"){
+    for(std::size_t i = 0; i < 10; ++i){
+      auto t = await_event(irq);
+      REQUIRE_FALSE(t.has_error());
+    }
+  }
+}
+
+TEST_CASE("async basic_scheduler<> event test", "[embtl][template][async]"){
+  embtl::async::basic_scheduler<2, host_irq_t> scheduler;
+  embtl::async::event irq;
+
+  SECTION("Task resumed after the event is signaled"){
+    auto t = await_event(irq);
+    REQUIRE(scheduler.spawn(t) == embtl::STATUS::OK);
+    REQUIRE(scheduler.spawn(t) == embtl::STATUS::INVALID_PARAMETER);
+    REQUIRE(scheduler.waiting() == 1);
+    REQUIRE(scheduler.run_once() == 0);
+    REQUIRE_FALSE(t.done());
+
+    irq.signal();
+    REQUIRE(scheduler.run_once() == 1);
+    REQUIRE(t.done());
+    REQUIRE(t.status() == embtl::STATUS::OK);
+    REQUIRE(scheduler.waiting() == 0);
+    REQUIRE_FALSE(irq.is_set());
+  }
+  SECTION("Signal before co_await is not lost"){
+    irq.signal();
+    auto t = await_event(irq);
+    REQUIRE(scheduler.spawn(t) == embtl::STATUS::OK);
+    REQUIRE(t.done());
+    REQUIRE(scheduler.waiting() == 0);
+  }
+  SECTION("Waiter list full"){
+    embtl::async::basic_scheduler<1, host_irq_t> small;
+    embtl::async::event other;
+    auto first = await_event(irq);
+    auto second = await_event(other);
+
+    REQUIRE(small.spawn(first) == embtl::STATUS::OK);
+    REQUIRE(small.spawn(second) == embtl::STATUS::OK);
+    REQUIRE(second.status() == embtl::STATUS::BUFFER_OVERFLOW);
+    REQUIRE(small.waiting() == 1);
+
+    irq.signal();
+    REQUIRE(small.run() == 0);
+    REQUIRE(first.status() == embtl::STATUS::OK);
+  }
+  SECTION("Interrupt between the pass and idle() is not lost"){
+    std::size_t checks = 0;
+    auto waiting = await_event(irq);
+    auto source = interrupt_after_pass(irq, checks);
+
+    REQUIRE(scheduler.spawn(waiting) == embtl::STATUS::OK);
+    REQUIRE(scheduler.spawn(source) == embtl::STATUS::OK);
+    REQUIRE(host_irq_t::pending() == 0);
+
+    REQUIRE(scheduler.run() == 0);
+    REQUIRE(checks == 3);
+    REQUIRE(waiting.status() == embtl::STATUS::OK);
+    REQUIRE(source.status() == embtl::STATUS::OK);
+  }
+}
+
+TEST_CASE("async basic_async_driver<> test", "[embtl][template][async][driver]"){
+  embtl::async::basic_scheduler<4, host_irq_t> scheduler;
+
+  SECTION("Register condition"){
+    spi_driver spi;
+    REQUIRE_FALSE(spi.has_error());
+    async_reg_ro_t::set_register(spi.registers().SR, 0x80);
+
+    auto t = spi.transfer(0x5A);
+    REQUIRE(scheduler.spawn(t) == embtl::STATUS::OK);
+    REQUIRE(spi.writes == 0);
+    REQUIRE(scheduler.run_once() == 0);
+
+    async_reg_ro_t::set_register(spi.registers().SR, 0x82);
+    REQUIRE(scheduler.run_once() == 1);
+    REQUIRE(spi.writes == 1);
+    REQUIRE(async_reg_rw_t::get_register(spi.registers().DR) == 0x5A);
+    REQUIRE_FALSE(t.done());
+
+    spi.transfer_done.signal();
+    REQUIRE(scheduler.run() == 0);
+    REQUIRE(t.status() == embtl::STATUS::OK);
+  }
+  SECTION("Nested tasks resumed by simulated interrupts"){
+    spi_driver spi;
+    async_reg_ro_t::set_register(spi.registers().SR, 0x02);
+
+    auto t = spi.transfer_block(0x10, 5);
+    REQUIRE(scheduler.spawn(t) == embtl::STATUS::OK);
+
+    std::size_t interrupts = 0;
+    while(!t.done()){
+      async_reg_ro_t::set_register(spi.registers().SR, 0x00);
+      REQUIRE(host_irq_t::raise(&spi_driver::irq_handler, &spi) == embtl::STATUS::OK);
+      const auto waiting = scheduler.run();
+      ++interrupts;
+      REQUIRE(waiting == (t.done() ? 0 : 1));
+      REQUIRE(interrupts <= 5);
+    }
+
+    REQUIRE(interrupts == 5);
+    REQUIRE(spi.writes == 5);
+    REQUIRE(async_reg_rw_t::get_register(spi.registers().DR) == 0x14);
+    REQUIRE(t.status() == embtl::STATUS::OK);
+    REQUIRE(host_irq_t::pending() == 0);
+  }
+  SECTION("Overlapped operations on one scheduler"){
+    std::vector<embtl::async::event> irqs(3);
+    std::vector<embtl::async::task<event_pool_t>> tasks;
+    tasks.push_back(await_event(irqs[0]));
+    tasks.push_back(await_event(irqs[1]));
+
+    for(auto& t : tasks){
+      REQUIRE(scheduler.spawn(t) == embtl::STATUS::OK);
+    }
+    REQUIRE(scheduler.waiting() == 2);
+
+    auto signal = [](void* context) noexcept { static_cast<embtl::async::event*>(context)->signal(); };
+    REQUIRE(host_irq_t::raise(signal, &irqs[1]) == embtl::STATUS::OK);
+    REQUIRE(host_irq_t::raise(signal, &irqs[0]) == embtl::STATUS::OK);
+
+    REQUIRE(scheduler.run() == 0);
+    REQUIRE(tasks[0].status() == embtl::STATUS::OK);
+    REQUIRE(tasks[1].status() == embtl::STATUS::OK);
+  }
+  SECTION("No simulated interrupt pending"){
+    spi_driver spi;
+    async_reg_ro_t::set_register(spi.registers().SR, 0x02);
+
+    auto t = spi.transfer(0x01);
+    REQUIRE(scheduler.spawn(t) == embtl::STATUS::OK);
+    REQUIRE(scheduler.run() == 1);
+    REQUIRE_FALSE(t.done());
+  }
+}
@@ -73,4 +73,41 @@ TEMPLATE_TEST_CASE_SIG("static_mask method test", "[embtl][bits][static_mask][te
       STATIC_REQUIRE(mask == mask_check<BaseType, MaskParams...>::value());
     }
   }
-}
\ No newline at end of file
+}
+enum class field_test_enum : std::uint8_t {
+  VALUE_0 = 0,
+  VALUE_1,
+  VALUE_2,
+  VALUE_3
+};
+
+TEMPLATE_TEST_CASE_SIG("field descriptor template test", "[embtl][bits][field][template]",
+                       ((typename BaseType, std::size_t Pos, std::size_t Size), BaseType, Pos, Size),
+                       (std::uint8_t, 0, 1),
+                       (std::uint8_t, 4, 4),
+                       (std::uint16_t, 3, 5),
+                       (embtl::arch_type, 8, 8),
+                       (embtl::arch_type, 0, 32),
+                       (std::uint64_t, 42, 8)
+){
+  using field_t = embtl::field<Pos, Size>;
+  using enum_field_t = embtl::field<Pos, Size, field_test_enum>;
+
+  SECTION("Concept Tests"){
+    STATIC_REQUIRE(embtl::register_bit_field<field_t>);
+    STATIC_REQUIRE(embtl::register_bit_field<enum_field_t>);
+    STATIC_REQUIRE_FALSE(embtl::register_bit_field<BaseType>);
+  }
+  SECTION("Compile Time Values"){
+    STATIC_REQUIRE(field_t::position == Pos);
+    STATIC_REQUIRE(field_t::size == Size);
+    STATIC_REQUIRE(field_t::template fits<BaseType>());
+    STATIC_REQUIRE(field_t::template mask<BaseType>() == embtl::make_mask<BaseType>(Pos, Size));
+    STATIC_REQUIRE(std::is_same_v<embtl::field_value_t<field_t, BaseType>, BaseType>);
+    STATIC_REQUIRE(std::is_same_v<embtl::field_value_t<enum_field_t, BaseType>, field_test_enum>);
+  }
+  SECTION("Out of range"){
+    using outside_t = embtl::field<std::numeric_limits<BaseType>::digits - Size + 1, Size>;
+    STATIC_REQUIRE_FALSE(outside_t::template fits<BaseType>());
+  }
+}
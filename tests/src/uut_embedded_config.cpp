@@ -0,0 +1,192 @@
+/**
+ * @file uut_embedded_config.cpp
+ * @date 2024-10-16
+ * @author Robert Morley
+ *
+ * @brief Unit Test : Embedded Template Library := apply_config() template test.
+ *
+ * @version v0.1.0
+ * @copyright Copyright (c) 2024
+ */
+#include <vector>
+#include <uut_catch2.hpp>
+#include <embedded_allocator.hpp>
+#include <embedded_config.hpp>
+
+namespace {
+    /**
+     * @brief Side effect that records the address of every register write and counts register reads.
+     */
+    struct config_side_effect final {
+      public:
+        static void read(volatile embtl::arch_type&){
+          ++reads;
+        }
+        static void write(volatile embtl::arch_type& reg, const embtl::arch_type& value){
+          writes.push_back(&reg);
+          reg = value;
+        }
+        static void write(volatile embtl::arch_type& reg, embtl::arch_type&& value){
+          writes.push_back(&reg);
+          reg = value;
+        }
+        static void reset() noexcept {
+          reads = 0;
+          writes.clear();
+        }
+
+        inline static std::size_t reads { 0 };
+        inline static std::vector<volatile embtl::arch_type*> writes { };
+    };
+
+    template<embtl::arch_type Mask = std::numeric_limits<embtl::arch_type>::max()>
+    using cfg_reg_rw_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_write<embtl::arch_type, Mask, config_side_effect>,
+                                                        embtl::arch_type, Mask>;
+    using cfg_reg_wo_t = embtl::basic_hardware_register<embtl::policy::basic_reg_write_only<embtl::arch_type, 0xFFFF, config_side_effect>,
+                                                        embtl::arch_type, 0xFFFF, 0x00A5>;
+    using cfg_reg_ro_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_only<embtl::arch_type, config_side_effect>>;
+
+    struct timer_registers_t {
+        cfg_reg_rw_t<>              CR1;
+        cfg_reg_rw_t<0x0000'FFFF>   CR2;
+        cfg_reg_ro_t                SR;
+        cfg_reg_wo_t                PSC;
+        cfg_reg_rw_t<>              ARR;
+    };
+
+    using cfg_reg_w1c_t = embtl::basic_hardware_register<embtl::policy::basic_reg_write_1_clear<embtl::arch_type>>;
+
+    struct status_registers_t {
+        cfg_reg_rw_t<>              CR;
+        cfg_reg_w1c_t               SR;
+    };
+
+    using tim_en_t = embtl::field<0>;
+    using tim_cms_t = embtl::field<5, 2>;
+    using tim_mms_t = embtl::field<4, 3>;
+
+    constexpr auto arr_config = embtl::config<&timer_registers_t::ARR>(999U);
+    constexpr auto cr1_config = embtl::config<&timer_registers_t::CR1>(tim_en_t{} = 1U, tim_cms_t{} = 2U);
+    constexpr auto cr2_config = embtl::config<&timer_registers_t::CR2>(0xFFFF'1234U);
+    constexpr auto psc_config = embtl::config<&timer_registers_t::PSC>(71U);
+}
+
+TEST_CASE("apply_config() template test", "[embtl][template][config]"){
+  timer_registers_t regs { };
+  auto init_value = GENERATE(take(10, random(std::numeric_limits<embtl::arch_type>::min(), std::numeric_limits<embtl::arch_type>::max())));
+
+  cfg_reg_rw_t<>::set_register(regs.CR1, init_value);
+  cfg_reg_rw_t<0x0000'FFFF>::set_register(regs.CR2, init_value & 0x0000'FFFF);
+  cfg_reg_rw_t<>::set_register(regs.ARR, init_value);
+  config_side_effect::reset();
+
+  SECTION("Compile Time Tests"){
+    STATIC_REQUIRE(arr_config.mask == 0xFFFF'FFFFU);
+    STATIC_REQUIRE(arr_config.value == 999U);
+    STATIC_REQUIRE(cr1_config.mask == 0x0000'0061U);
+    STATIC_REQUIRE(cr1_config.value == 0x0000'0041U);
+    STATIC_REQUIRE(cr2_config.value == 0x0000'1234U);
+    STATIC_REQUIRE(embtl::register_config_entry<decltype(psc_config)>);
+    STATIC_REQUIRE_FALSE(embtl::register_config_entry<embtl::arch_type>);
+  }
+  SECTION("Listed order, changed registers only"){
+    const auto written = embtl::apply_config(regs, psc_config, arr_config, cr1_config, cr2_config);
+    const auto cr1_value = (init_value & ~0x61U) | 0x41U;
+    const auto expected = std::size_t { 1 } + (init_value != 999U) + (init_value != cr1_value) + ((init_value & 0xFFFFU) != 0x1234U);
+
+    REQUIRE(written == expected);
+    REQUIRE(config_side_effect::writes.size() == expected);
+    REQUIRE(config_side_effect::writes.front() == reinterpret_cast<volatile embtl::arch_type*>(&regs.PSC));
+    REQUIRE(config_side_effect::reads == 3);
+    REQUIRE(cfg_reg_wo_t::get_register(regs.PSC) == 71U);
+    REQUIRE(cfg_reg_rw_t<>::get_register(regs.ARR) == 999U);
+    REQUIRE(cfg_reg_rw_t<>::get_register(regs.CR1) == cr1_value);
+    REQUIRE(cfg_reg_rw_t<0x0000'FFFF>::get_register(regs.CR2) == 0x1234U);
+
+    config_side_effect::reset();
+    REQUIRE(embtl::apply_config(regs, arr_config, cr1_config, cr2_config) == 0);
+    REQUIRE(config_side_effect::writes.empty());
+  }
+  SECTION("Declaration order"){
+    const auto written = embtl::apply_config<embtl::config_order::declaration>(regs, arr_config, psc_config, cr1_config);
+
+    REQUIRE(written == config_side_effect::writes.size());
+    REQUIRE(std::is_sorted(config_side_effect::writes.begin(), config_side_effect::writes.end()));
+    REQUIRE(cfg_reg_rw_t<>::get_register(regs.ARR) == 999U);
+  }
+  SECTION("Repeated register"){
+    constexpr auto cr1_mms_config = embtl::config<&timer_registers_t::CR1>(tim_mms_t{} = 5U);
+    const auto cr1_value = (init_value & ~0x71U) | 0x51U;
+
+    SECTION("Listed order"){
+      const auto written = embtl::apply_config(regs, cr1_config, arr_config, cr1_mms_config);
+
+      REQUIRE(written == config_side_effect::writes.size());
+      REQUIRE(cfg_reg_rw_t<>::get_register(regs.CR1) == cr1_value);
+      REQUIRE(cfg_reg_rw_t<>::get_register(regs.ARR) == 999U);
+    }
+    SECTION("Declaration order"){
+      const auto written = embtl::apply_config<embtl::config_order::declaration>(regs, cr1_config, arr_config, cr1_mms_config);
+
+      REQUIRE(written == config_side_effect::writes.size());
+      REQUIRE(written == std::size_t { init_value != cr1_value } + (init_value != 999U));
+      REQUIRE(config_side_effect::reads == 2U + (init_value == ((init_value & ~0x61U) | 0x41U))); // CR1 is read again only if not staged.
+      REQUIRE(cfg_reg_rw_t<>::get_register(regs.CR1) == cr1_value);
+      REQUIRE(cfg_reg_rw_t<>::get_register(regs.ARR) == 999U);
+    }
+  }
+  SECTION("Shadow values"){
+    embtl::register_snapshot<timer_registers_t> shadow { };
+
+    REQUIRE(embtl::apply_config(regs, shadow, psc_config, cr1_config, cr2_config) == 3);
+    REQUIRE(config_side_effect::reads == 0);
+    REQUIRE(shadow.get<&timer_registers_t::PSC>() == 71U);
+    REQUIRE(shadow.get<&timer_registers_t::CR1>() == 0x41U);
+
+    config_side_effect::reset();
+    REQUIRE(embtl::apply_config(regs, shadow, psc_config, cr1_config, cr2_config,
+                                embtl::config<&timer_registers_t::CR2>(tim_mms_t{} = 5U)) == 1);
+    REQUIRE(config_side_effect::writes.size() == 1);
+    REQUIRE(cfg_reg_rw_t<0x0000'FFFF>::get_register(regs.CR2) == 0x1254U);
+    REQUIRE(config_side_effect::reads == 0);
+  }
+  SECTION("Register map image"){
+    auto desired = embtl::register_snapshot<timer_registers_t> { };
+    desired.set<&timer_registers_t::CR1>(init_value);
+    desired.set<&timer_registers_t::CR2>(0xABCD'0000U | (init_value & 0xFFFFU));
+    desired.set<&timer_registers_t::ARR>(~init_value);
+
+    REQUIRE(embtl::apply_config(regs, desired) == 1);
+    REQUIRE(config_side_effect::writes.front() == reinterpret_cast<volatile embtl::arch_type*>(&regs.ARR));
+    REQUIRE(cfg_reg_rw_t<>::get_register(regs.ARR) == ~init_value);
+  }
+}
+
+TEST_CASE("apply_config() write-one-to-clear test", "[embtl][template][config][w1c]"){
+  using flag0_t = embtl::field<1>;
+  using flag1_t = embtl::field<2>;
+
+  status_registers_t regs { };
+  cfg_reg_w1c_t::set_register(regs.SR, 0x0000'0006U);      // two flags pending.
+  config_side_effect::reset();
+
+  constexpr auto clear_flag0 = embtl::config<&status_registers_t::SR>(flag0_t{} = 1U);
+  constexpr auto clear_flag1 = embtl::config<&status_registers_t::SR>(flag1_t{} = 1U);
+
+  SECTION("Listed order"){
+    REQUIRE(embtl::apply_config(regs, clear_flag0) == 1);
+    REQUIRE(cfg_reg_w1c_t::get_register(regs.SR) == 0x0000'0004U);
+  }
+  SECTION("Declaration order"){
+    REQUIRE(embtl::apply_config<embtl::config_order::declaration>(regs, clear_flag0) == 1);
+    REQUIRE(cfg_reg_w1c_t::get_register(regs.SR) == 0x0000'0004U);
+  }
+  SECTION("Repeated register, declaration order"){
+    REQUIRE(embtl::apply_config<embtl::config_order::declaration>(regs, clear_flag0, clear_flag1) == 1);
+    REQUIRE(cfg_reg_w1c_t::get_register(regs.SR) == 0);
+  }
+  SECTION("No flag to clear"){
+    REQUIRE(embtl::apply_config(regs, embtl::config<&status_registers_t::SR>(flag0_t{} = 0U)) == 0);
+    REQUIRE(cfg_reg_w1c_t::get_register(regs.SR) == 0x0000'0006U);
+  }
+}
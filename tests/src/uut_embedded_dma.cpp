@@ -0,0 +1,230 @@
+/**
+ * @file uut_embedded_dma.cpp
+ * @date 2024-10-17
+ * @author Robert Morley
+ *
+ * @brief
+ *
+ * @version v0.1.0
+ * @copyright Copyright (c) 2024
+ */
+#include <atomic>
+#include <numeric>
+#include <vector>
+#include <uut_catch2.hpp>
+#include <embedded_dma.hpp>
+#include <embedded_allocator.hpp>
+#include <embedded_region.hpp>
+
+namespace {
+    namespace dma = embtl::dma;
+
+    using dma_reg_rw_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_write<embtl::arch_type>>;
+
+    struct dac_registers_t {
+        dma_reg_rw_t CR;
+        dma_reg_rw_t DHR;
+    };
+
+    using dac_region_t = embtl::basic_device_region<dac_registers_t, embtl::basic_mmio_single_device_allocator<{0x4000'7400}, std::true_type>>;
+    using dma_region_t = embtl::basic_device_region<dma::channel_register_map, embtl::basic_mmio_single_device_allocator<{0x4002'0008}, std::true_type>>;
+    using dma_engine_t = dma::host_engine<dma_region_t>;
+
+    /**
+     * @brief DAC driver, exposes the data register for the DMA descriptors.
+     */
+    struct dac_driver final : public embtl::basic_driver<dac_region_t> {
+      public:
+        dma_reg_rw_t& data_register() noexcept { return reg_map->DHR; }
+    };
+
+    struct dma_channel final : public embtl::basic_dma_channel<dma_region_t> {
+      public:
+        auto wait_done() noexcept { return wait<embtl::wait::yield>(100'000'000); }
+    };
+
+    using gather_block_t = dma::descriptor_block<3, struct gather_tag>;
+    using ring_block_t = dma::descriptor_block<2, struct ring_tag>;
+
+    EMBEDDED_MEMORY_SECTION(dma_descriptor_section, ".dma_descriptors", 1024, 32, gather_block_t, ring_block_t);
+
+    using descriptor_allocator_t = embtl::basic_section_allocator<dma_descriptor_section>;
+
+    constexpr auto dac_chain = dma::make_chain<dma::link::CIRCULAR>(
+        dma::memory_to_peripheral<std::uint16_t>(0x2000'0000, 0x4000'7408, 64),
+        dma::memory_to_peripheral<std::uint16_t>(0x2000'0080, 0x4000'7408, 64, dma::INTERRUPT)
+    );
+
+    void count_interrupt(void* context) noexcept {
+      static_cast<std::atomic<std::size_t>*>(context)->fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+TEST_CASE("dma descriptor test", "[embtl][template][dma]"){
+  SECTION("Typed descriptors"){
+    constexpr auto item = dma::memory_to_memory<std::uint32_t>(0x2000'0000, 0x2000'1000, 16, dma::INTERRUPT);
+    STATIC_REQUIRE(item.element_width == dma::width::WORD);
+    STATIC_REQUIRE(item.control == (dma::SOURCE_INCREMENT | dma::DESTINATION_INCREMENT | dma::INTERRUPT));
+    STATIC_REQUIRE(item.bytes() == 64);
+    STATIC_REQUIRE(item.next == 0);
+    STATIC_REQUIRE(dma::validate(item) == embtl::STATUS::OK);
+
+    STATIC_REQUIRE(dma::memory_to_peripheral<std::uint8_t>(0x2000'0000, 0x4001'1004, 8).control == dma::SOURCE_INCREMENT);
+    STATIC_REQUIRE(dma::peripheral_to_memory<std::uint16_t>(0x4001'2440, 0x2000'0000, 8).control == dma::DESTINATION_INCREMENT);
+    STATIC_REQUIRE(dma::width_of<std::uint64_t> == dma::width::DOUBLE_WORD);
+  }
+  SECTION("Invalid descriptors"){
+    STATIC_REQUIRE(dma::validate(dma::memory_to_memory<std::uint32_t>(0x2000'0000, 0x2000'1000, 0)) == embtl::STATUS::INVALID_PARAMETER);
+    STATIC_REQUIRE(dma::validate(dma::memory_to_memory<std::uint32_t>(0x2000'0002, 0x2000'1000, 4)) == embtl::STATUS::INVALID_PARAMETER);
+    STATIC_REQUIRE(dma::validate(dma::memory_to_memory<std::uint16_t>(0x2000'0000, 0x2000'1001, 4)) == embtl::STATUS::INVALID_PARAMETER);
+    STATIC_REQUIRE(dma::validate(dma::peripheral_to_memory<std::uint8_t>(0, 0x2000'1000, 4)) == embtl::STATUS::INVALID_PARAMETER);
+
+    constexpr dma::descriptor bad_width { 0x2000'0000, 0x2000'1000, 4, static_cast<dma::width>(3), dma::NONE, 0, 0 };
+    STATIC_REQUIRE(dma::validate(bad_width) == embtl::STATUS::INVALID_PARAMETER);
+  }
+  SECTION("Register descriptors"){
+    dac_driver dac;
+    REQUIRE_FALSE(dac.has_error());
+    std::array<embtl::arch_type, 4> samples { };
+
+    const auto out = dma::memory_to_peripheral(samples.data(), dac.data_register(), 4);
+    REQUIRE(out.source == reinterpret_cast<dma::bus_address>(samples.data()));
+    REQUIRE(out.destination == reinterpret_cast<dma::bus_address>(&dac.data_register()));
+    REQUIRE(out.element_width == dma::width_of<embtl::arch_type>);
+
+    const auto in = dma::peripheral_to_memory(dac.data_register(), samples.data(), 4);
+    REQUIRE(in.source == out.destination);
+    REQUIRE(in.control == dma::DESTINATION_INCREMENT);
+  }
+}
+
+TEST_CASE("dma chain placement test", "[embtl][template][dma]"){
+  SECTION("Compile time chain"){
+    STATIC_REQUIRE(dac_chain.size() == 2);
+    STATIC_REQUIRE(dac_chain.bytes() == 256);
+    STATIC_REQUIRE(dac_chain.mode == dma::link::CIRCULAR);
+
+    const auto first = dma::place<descriptor_allocator_t, ring_block_t>(dac_chain);
+    REQUIRE(first == embtl::STATUS::OK);
+
+    const auto* block = descriptor_allocator_t::get<ring_block_t>();
+    REQUIRE(first.get_value() == block->descriptors.data());
+    REQUIRE(reinterpret_cast<std::uintptr_t>(block) % dma::descriptor_alignment == 0);
+    REQUIRE(block->descriptors[0].next == reinterpret_cast<dma::bus_address>(&block->descriptors[1]));
+    REQUIRE(block->descriptors[1].next == reinterpret_cast<dma::bus_address>(&block->descriptors[0]));
+    REQUIRE(block->descriptors[1].control == (dma::SOURCE_INCREMENT | dma::INTERRUPT));
+  }
+  SECTION("Linear chain in a larger block"){
+    dma::descriptor_block<4> block { };
+    const auto chain = dma::make_chain(dma::memory_to_memory<std::uint8_t>(0x2000'0000, 0x2000'1000, 3),
+                                       dma::memory_to_memory<std::uint8_t>(0x2000'0010, 0x2000'1003, 5));
+    const auto first = dma::place(chain, block);
+
+    REQUIRE(first == embtl::STATUS::OK);
+    REQUIRE(block.descriptors[0].next == reinterpret_cast<dma::bus_address>(&block.descriptors[1]));
+    REQUIRE(block.descriptors[1].next == 0);
+    REQUIRE(block.descriptors[2].count == 0);
+  }
+  SECTION("Run time chain with an invalid descriptor"){
+    dma::descriptor_block<2> block { };
+    std::array<std::uint32_t, 4> buffer { };
+    const auto chain = dma::make_chain(dma::memory_to_memory(buffer.data(), buffer.data() + 2, 2),
+                                       dma::memory_to_memory(buffer.data(), buffer.data(), 0));
+    const auto first = dma::place(chain, block);
+
+    REQUIRE(first == embtl::STATUS::INVALID_PARAMETER);
+    REQUIRE(first.get_value() == nullptr);
+    REQUIRE(block.descriptors[0].count == 0);
+  }
+}
+
+TEST_CASE("basic_dma_channel<> host engine test", "[embtl][template][dma][driver][thread]"){
+  std::atomic<std::size_t> interrupts { 0 };
+  dma_engine_t engine(&count_interrupt, &interrupts);
+  dma_channel channel;
+  REQUIRE_FALSE(channel.has_error());
+
+  SECTION("Scatter-gather memory to memory"){
+    std::array<std::uint16_t, 5> header { };
+    std::array<std::uint16_t, 32> payload { };
+    std::array<std::uint16_t, 3> trailer { };
+    std::iota(header.begin(), header.end(), std::uint16_t{100});
+    std::iota(payload.begin(), payload.end(), std::uint16_t{200});
+    std::iota(trailer.begin(), trailer.end(), std::uint16_t{300});
+    std::vector<std::uint16_t> frame(header.size() + payload.size() + trailer.size(), 0);
+
+    const auto chain = dma::make_chain(
+        dma::memory_to_memory(header.data(), frame.data(), 5),
+        dma::memory_to_memory(payload.data(), frame.data() + 5, 32, dma::INTERRUPT),
+        dma::memory_to_memory(trailer.data(), frame.data() + 37, 3));
+    const auto first = dma::place<descriptor_allocator_t, gather_block_t>(chain);
+    REQUIRE(first == embtl::STATUS::OK);
+
+    REQUIRE(channel.start(first.get_value(), true) == embtl::STATUS::OK);
+    REQUIRE(channel.wait_done() == embtl::STATUS::OK);
+    REQUIRE_FALSE(channel.busy());
+    REQUIRE(channel.completed() == 3);
+    REQUIRE(engine.chains() == 1);
+    REQUIRE(interrupts.load() == 2);
+
+    for(std::size_t i = 0; i < frame.size(); ++i){
+      const auto expected = i < 5 ? 100 + i : (i < 37 ? 200 + i - 5 : 300 + i - 37);
+      REQUIRE(frame[i] == expected);
+    }
+  }
+  SECTION("Memory to peripheral with a fixed destination"){
+    dac_driver dac;
+    std::array<embtl::arch_type, 8> samples { 1, 2, 3, 4, 5, 6, 7, 0x0FFF };
+    dma::descriptor_block<1> block { };
+
+    const auto first = dma::place(dma::make_chain(dma::memory_to_peripheral(samples.data(), dac.data_register(), 8)), block);
+    REQUIRE(channel.start(first.get_value()) == embtl::STATUS::OK);
+    REQUIRE(channel.wait_done() == embtl::STATUS::OK);
+    REQUIRE(dma_reg_rw_t::get_register(dac.data_register()) == 0x0FFF);
+    REQUIRE(interrupts.load() == 0);
+  }
+  SECTION("Invalid descriptor in descriptor memory"){
+    std::array<std::uint32_t, 4> source { 1, 2, 3, 4 };
+    std::array<std::uint32_t, 4> destination { };
+    dma::descriptor_block<2> block { };
+
+    REQUIRE(dma::place(dma::make_chain(dma::memory_to_memory(source.data(), destination.data(), 4),
+                                       dma::memory_to_memory(source.data(), destination.data(), 4)), block) == embtl::STATUS::OK);
+    block.descriptors[1].count = 0;
+
+    REQUIRE(channel.start(block.descriptors.data()) == embtl::STATUS::OK);
+    const auto result = channel.wait_done();
+    REQUIRE(result == embtl::STATUS::ERROR);
+    REQUIRE(result.get_value() == dma::SR_ERROR::mask<dma::bus_address>());
+    REQUIRE(channel.completed() == 1);
+    REQUIRE(channel.current() == &block.descriptors[1]);
+    REQUIRE(destination == source);
+  }
+  SECTION("Circular chain stopped with abort"){
+    std::array<std::uint8_t, 16> source { };
+    std::array<std::uint8_t, 16> destination { };
+    dma::descriptor_block<2> block { };
+
+    const auto first = dma::place(dma::make_chain<dma::link::CIRCULAR>(
+        dma::memory_to_memory(source.data(), destination.data(), 8),
+        dma::memory_to_memory(source.data() + 8, destination.data() + 8, 8, dma::INTERRUPT)), block);
+    REQUIRE(channel.start(first.get_value()) == embtl::STATUS::OK);
+    REQUIRE(channel.start(first.get_value()) == embtl::STATUS::BUSY);
+    REQUIRE(channel.wait(1) == embtl::STATUS::TIMEOUT);
+    REQUIRE(channel.wait(1).has_error());
+
+    while(interrupts.load() < 3){
+      std::this_thread::yield();
+    }
+    REQUIRE(channel.abort() == embtl::STATUS::BUSY);
+    const auto result = channel.wait_done();
+    REQUIRE(result == embtl::STATUS::ERROR);
+    REQUIRE(result.get_value() == dma::SR_ABORTED::mask<dma::bus_address>());
+    REQUIRE(channel.completed() >= 6);
+    REQUIRE(channel.abort() == embtl::STATUS::OK);
+  }
+  SECTION("Start parameters"){
+    REQUIRE(channel.start(nullptr) == embtl::STATUS::INVALID_PARAMETER);
+    REQUIRE_FALSE(channel.busy());
+  }
+}
@@ -10,3 +10,52 @@
  */
 #include <uut_catch2.hpp>
 #include <embedded_driver.hpp>
+#include <embedded_allocator.hpp>
+#include <embedded_register.hpp>
+
+namespace {
+    using drv_reg_rw_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_write<embtl::arch_type>>;
+    using drv_reg_ro_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_only<embtl::arch_type>>;
+
+    struct rcc_registers_t {
+        drv_reg_rw_t CR;
+        drv_reg_rw_t CFGR;
+        drv_reg_ro_t CIR;
+    };
+
+    using rcc_static_region_t = embtl::basic_device_region<rcc_registers_t, embtl::basic_mmio_single_device_allocator<{0x4002'1000}>>;
+    using rcc_host_region_t = embtl::basic_device_region<rcc_registers_t, embtl::basic_mmio_single_device_allocator<{0x4002'1000}, std::true_type>>;
+    struct target_allocation : public std::false_type {};
+    using rcc_target_region_t = embtl::basic_device_region<rcc_registers_t, embtl::basic_mmio_single_device_allocator<{0x4002'1000}, target_allocation>>;
+    using rcc_list_region_t = embtl::basic_device_region<rcc_registers_t, embtl::basic_hardware_allocator<1, {1_uz, 0x4002'1000}>>;
+    using rcc_registers_static_t = embtl::basic_mmio_device_registers<rcc_registers_t, embtl::basic_mmio_single_device_allocator<{0x4002'1000}>>;
+
+    struct rcc_driver final : public embtl::static_driver<rcc_static_region_t> {
+      public:
+        [[nodiscard]] static auto cfgr_address() noexcept -> const volatile void* { return &reg_map->CFGR; }
+        [[nodiscard]] static auto region() noexcept -> rcc_static_region_t* { return &*reg_map; }
+    };
+}
+
+TEST_CASE("static_driver<> template test", "[embtl][template][driver][static]"){
+  SECTION("Compile Time Tests"){
+    STATIC_REQUIRE(embtl::static_device_region<rcc_static_region_t>);
+    STATIC_REQUIRE(embtl::static_device_region<rcc_registers_static_t>);
+    STATIC_REQUIRE(embtl::static_device_region<rcc_target_region_t>);
+    STATIC_REQUIRE_FALSE(embtl::static_device_region<rcc_host_region_t>);
+    STATIC_REQUIRE_FALSE(embtl::static_device_region<rcc_list_region_t>);
+
+    STATIC_REQUIRE(std::is_empty_v<rcc_driver>);
+    STATIC_REQUIRE(std::is_empty_v<embtl::static_driver<rcc_registers_static_t>>);
+    STATIC_REQUIRE(rcc_driver::base_address == 0x4002'1000);
+    STATIC_REQUIRE_FALSE(rcc_driver::has_error());
+
+    STATIC_REQUIRE(std::is_same_v<embtl::driver_base_t<rcc_static_region_t>, embtl::static_driver<rcc_static_region_t>>);
+    STATIC_REQUIRE(std::is_same_v<embtl::driver_base_t<rcc_host_region_t>, embtl::basic_driver<rcc_host_region_t>>);
+    STATIC_REQUIRE(std::is_same_v<embtl::driver_base_t<rcc_list_region_t>, embtl::basic_driver<rcc_list_region_t>>);
+  }
+  SECTION("Register map address"){
+    REQUIRE(rcc_driver::region() == reinterpret_cast<rcc_static_region_t*>(0x4002'1000));
+    REQUIRE(rcc_driver::cfgr_address() == reinterpret_cast<const volatile void*>(0x4002'1000 + sizeof(embtl::arch_type)));
+  }
+}
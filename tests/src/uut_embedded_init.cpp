@@ -0,0 +1,93 @@
+/**
+ * @file uut_embedded_init.cpp
+ * @date 2024-10-16
+ * @author Robert Morley
+ *
+ * @brief Unit Test : Embedded Template Library := init::table<> template test.
+ *
+ * @version v0.1.0
+ * @copyright Copyright (c) 2024
+ */
+#include <cstddef>
+#include <uut_catch2.hpp>
+#include <embedded_allocator.hpp>
+#include <embedded_region.hpp>
+#include <embedded_init.hpp>
+
+namespace {
+    using init_reg_rw_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_write<embtl::arch_type>>;
+    using init_reg_ro_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_only<embtl::arch_type>>;
+    using init_reg_wo_t = embtl::basic_hardware_register<embtl::policy::basic_reg_write_only<embtl::arch_type, 0x0000'FFFF>,
+                                                         embtl::arch_type, 0x0000'FFFF>;
+
+    struct clock_registers_t {
+        init_reg_rw_t CR;
+        init_reg_ro_t SR;
+        init_reg_wo_t DIV;
+        init_reg_rw_t CFG;
+    };
+
+    using clk_on_t = embtl::field<0>;
+    using clk_src_t = embtl::field<4, 2>;
+    using clk_ready_t = embtl::field<1>;
+    using cfg_mul_t = embtl::field<8, 8>;
+
+    constexpr auto clock_init = embtl::init::make_table<clock_registers_t>(
+        embtl::init::write<EMBEDDED_INIT_REGISTER(clock_registers_t, DIV)>(0xFFFF'0004U),
+        embtl::init::modify<EMBEDDED_INIT_REGISTER(clock_registers_t, CR)>(clk_on_t{} = 1U, clk_src_t{} = 2U),
+        embtl::init::delay(16),
+        embtl::init::wait<EMBEDDED_INIT_REGISTER(clock_registers_t, SR), clk_ready_t>(1U, 100),
+        embtl::init::modify<&clock_registers_t::CFG, offsetof(clock_registers_t, CFG)>(cfg_mul_t{} = 0x2AU)
+    );
+}
+
+TEST_CASE("init::table<> template test", "[embtl][template][init]"){
+  using region_t = embtl::basic_device_region<clock_registers_t, embtl::basic_mmio_single_device_allocator<{0x4002'1000}>>;
+
+  auto init_value = GENERATE(take(10, random(std::numeric_limits<embtl::arch_type>::min(), std::numeric_limits<embtl::arch_type>::max())));
+
+  SECTION("Compile Time Tests"){
+    STATIC_REQUIRE(clock_init.size() == 5);
+    STATIC_REQUIRE(clock_init.entries[0].operation == embtl::init::op::WRITE);
+    STATIC_REQUIRE(clock_init.entries[0].value == 0x0000'0004U);
+    STATIC_REQUIRE(clock_init.entries[1].offset == 0);
+    STATIC_REQUIRE(clock_init.entries[1].mask == 0x0000'0031U);
+    STATIC_REQUIRE(clock_init.entries[1].value == 0x0000'0021U);
+    STATIC_REQUIRE(clock_init.entries[3].offset == sizeof(embtl::arch_type));
+    STATIC_REQUIRE(clock_init.entries[3].count == 100);
+
+    // Registers whose policy must run on every access are rejected.
+    using embtl::init::details::is_plain_policy;
+    STATIC_REQUIRE(is_plain_policy<embtl::register_access_policy<init_reg_rw_t>>::value);
+    STATIC_REQUIRE(is_plain_policy<embtl::register_access_policy<init_reg_wo_t>>::value);
+    STATIC_REQUIRE_FALSE(is_plain_policy<embtl::policy::basic_reg_write_only_shadowed<embtl::arch_type>>::value);
+    STATIC_REQUIRE_FALSE(is_plain_policy<embtl::policy::basic_reg_write_1_clear<embtl::arch_type>>::value);
+    STATIC_REQUIRE_FALSE(is_plain_policy<embtl::policy::basic_reg_read_write<embtl::arch_type, 0xFFFF'FFFF, void, false, embtl::lock::primask_lock>>::value);
+  }
+  SECTION("Table walk"){
+    region_t regs { };
+    init_reg_rw_t::set_register(regs.CR, init_value);
+    init_reg_ro_t::set_register(regs.SR, init_value | 0x2U);
+    init_reg_rw_t::set_register(regs.CFG, init_value);
+
+    const auto result = embtl::init::run(regs, clock_init);
+
+    REQUIRE(result.get_status() == embtl::STATUS::OK);
+    REQUIRE(result.get_value() == clock_init.size());
+    REQUIRE(init_reg_wo_t::get_register(regs.DIV) == 0x0000'0004U);
+    REQUIRE(init_reg_rw_t::get_register(regs.CR) == ((init_value & ~0x31U) | 0x21U));
+    REQUIRE(init_reg_rw_t::get_register(regs.CFG) == ((init_value & ~0xFF00U) | 0x2A00U));
+  }
+  SECTION("Wait timeout"){
+    region_t regs { };
+    init_reg_rw_t::set_register(regs.CFG, init_value);
+    init_reg_ro_t::set_register(regs.SR, init_value & ~0x2U);
+
+    const auto result = embtl::init::run(regs, clock_init);
+
+    REQUIRE(result.get_status() == embtl::STATUS::TIMEOUT);
+    REQUIRE(result.has_error());
+    REQUIRE(result.get_value() == 3);
+    REQUIRE(init_reg_rw_t::get_register(regs.CFG) == init_value);
+  }
+}
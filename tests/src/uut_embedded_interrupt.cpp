@@ -0,0 +1,162 @@
+/**
+ * @file uut_embedded_interrupt.cpp
+ * @date 2024-10-17
+ * @author Robert Morley
+ *
+ * @brief
+ *
+ * @version v0.1.0
+ * @copyright Copyright (c) 2024
+ */
+#include <thread>
+#include <vector>
+#include <uut_catch2.hpp>
+#include <embedded_interrupt.hpp>
+#include <embedded_driver.hpp>
+#include <embedded_register.hpp>
+
+namespace {
+    using irq_reg_rw_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_write<embtl::arch_type>>;
+
+    struct timer_registers_t {
+        irq_reg_rw_t CR;
+        irq_reg_rw_t SR;
+    };
+
+    using timer_region_t = embtl::basic_device_region<timer_registers_t, embtl::basic_mmio_single_device_allocator<{0x4000'0000}>>;
+
+    std::array<std::atomic<std::size_t>, 8> irq_calls { };
+
+    /**
+     * @brief Static driver with a member handler, the handler does not touch the registers on the host.
+     */
+    struct timer_driver final : public embtl::static_driver<timer_region_t> {
+      public:
+        void on_update() noexcept { irq_calls[2].fetch_add(1, std::memory_order_relaxed); }
+        static void on_capture() noexcept { irq_calls[5].fetch_add(1, std::memory_order_relaxed); }
+    };
+
+    void default_handler() noexcept { irq_calls[0].fetch_add(1, std::memory_order_relaxed); }
+    void dma_handler() noexcept { irq_calls[7].fetch_add(1, std::memory_order_relaxed); }
+
+    using vectors_t = embtl::irq::vector_table<8, &default_handler,
+                                               embtl::irq::bind<2, &timer_driver::on_update>,
+                                               embtl::irq::bind<5, &timer_driver::on_capture>,
+                                               embtl::irq::bind<7, &dma_handler>>;
+    using controller_t = embtl::irq::host_interrupt_controller<vectors_t>;
+
+    /**
+     * @brief Handlers recording the dispatch order, chain_high raises a lower interrupt number while it runs.
+     */
+    std::vector<std::size_t> order;
+    void chain_high() noexcept;
+    void chain_low() noexcept { order.push_back(1); }
+
+    using chain_vectors_t = embtl::irq::vector_table<4, &default_handler,
+                                                     embtl::irq::bind<1, &chain_low>,
+                                                     embtl::irq::bind<3, &chain_high>>;
+    using chain_controller_t = embtl::irq::host_interrupt_controller<chain_vectors_t>;
+
+    void chain_high() noexcept {
+      order.push_back(3);
+      if(order.size() == 1){
+        chain_controller_t::raise(1);
+      }
+    }
+
+    void reset_calls() noexcept {
+      for(auto& calls : irq_calls){
+        calls.store(0);
+      }
+    }
+}
+
+TEST_CASE("vector_table<> template test", "[embtl][template][interrupt]"){
+  reset_calls();
+
+  SECTION("Compile time table"){
+    STATIC_REQUIRE(vectors_t::size() == 8);
+    STATIC_REQUIRE(vectors_t::vectors[0] == &default_handler);
+    STATIC_REQUIRE(vectors_t::vectors[2] == &embtl::irq::bind<2, &timer_driver::on_update>::isr);
+    STATIC_REQUIRE(vectors_t::vectors[5] == &embtl::irq::bind<5, &timer_driver::on_capture>::isr);
+    STATIC_REQUIRE(vectors_t::vectors[7] == &embtl::irq::bind<7, &dma_handler>::isr);
+    STATIC_REQUIRE(vectors_t::is_bound(2));
+    STATIC_REQUIRE_FALSE(vectors_t::is_bound(3));
+    STATIC_REQUIRE(std::is_empty_v<timer_driver>);
+  }
+  SECTION("Entries call the bound handlers"){
+    for(const auto vector : vectors_t::vectors){
+      vector();
+    }
+    REQUIRE(irq_calls[0] == 5);
+    REQUIRE(irq_calls[2] == 1);
+    REQUIRE(irq_calls[5] == 1);
+    REQUIRE(irq_calls[7] == 1);
+  }
+}
+
+TEST_CASE("host_interrupt_controller<> template test", "[embtl][template][interrupt]"){
+  reset_calls();
+
+  SECTION("Raise and dispatch"){
+    REQUIRE(controller_t::raise(5) == embtl::STATUS::OK);
+    REQUIRE(controller_t::raise(8) == embtl::STATUS::OUT_OF_RANGE);
+    REQUIRE(controller_t::is_pending(5));
+    REQUIRE(controller_t::dispatch() == 1);
+    REQUIRE_FALSE(controller_t::is_pending(5));
+    REQUIRE(irq_calls[5] == 1);
+    REQUIRE(controller_t::dispatch() == 0);
+  }
+  SECTION("Disabled interrupts stay pending"){
+    controller_t::disable(2);
+    REQUIRE(controller_t::raise(2) == embtl::STATUS::OK);
+    REQUIRE(controller_t::dispatch() == 0);
+    REQUIRE(controller_t::is_pending(2));
+
+    controller_t::enable(2);
+    REQUIRE(controller_t::dispatch() == 1);
+    REQUIRE(irq_calls[2] == 1);
+  }
+  SECTION("Lowest interrupt number first"){
+    order.clear();
+    REQUIRE(chain_controller_t::raise(3) == embtl::STATUS::OK);
+    REQUIRE(chain_controller_t::dispatch() == 2);
+    REQUIRE(order == std::vector<std::size_t>{ 3, 1 });
+
+    REQUIRE(chain_controller_t::raise(3) == embtl::STATUS::OK);
+    REQUIRE(chain_controller_t::raise(1) == embtl::STATUS::OK);
+    REQUIRE(chain_controller_t::dispatch() == 2);
+    REQUIRE(order == std::vector<std::size_t>{ 3, 1, 1, 3 });
+  }
+  SECTION("Interrupts raised from test threads"){
+    constexpr std::size_t raises = 1'000;
+    std::atomic<bool> running { true };
+    std::atomic<std::size_t> dispatched { 0 };
+
+    std::thread core([&running, &dispatched](){
+      while(running.load()){
+        dispatched += controller_t::dispatch();
+      }
+      dispatched += controller_t::dispatch();
+    });
+    std::vector<std::thread> sources;
+    for(const std::size_t irq : { 2_uz, 5_uz, 7_uz }){
+      sources.emplace_back([irq](){
+        for(std::size_t i = 0; i < raises; ++i){
+          while(controller_t::is_pending(irq)){ }
+          controller_t::raise(irq);
+        }
+      });
+    }
+    for(auto& source : sources){
+      source.join();
+    }
+    running.store(false);
+    core.join();
+
+    REQUIRE(dispatched == 3 * raises);
+    REQUIRE(irq_calls[2] == raises);
+    REQUIRE(irq_calls[5] == raises);
+    REQUIRE(irq_calls[7] == raises);
+  }
+}
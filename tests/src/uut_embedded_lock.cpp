@@ -0,0 +1,75 @@
+/**
+ * @file uut_embedded_lock.cpp
+ * @date 2024-10-14
+ * @author Robert Morley
+ *
+ * @brief Unit Test for Embedded Template Library header file "embedded_lock.hpp"
+ *
+ * @version v1.0.0
+ * @copyright Copyright (c) 2024
+ */
+#include <uut_catch2.hpp>
+#include <embedded_lock.hpp>
+#include <thread>
+#include <vector>
+
+namespace {
+    struct uut_lock_tag { };
+    /**
+     * @brief Increments a non-atomic counter from multiple threads while holding the Lock policy.
+     */
+    template<typename Lock>
+    std::size_t locked_count(const std::size_t thread_count, const std::size_t iterations){
+      std::size_t counter { 0 };
+      std::vector<std::thread> threads;
+
+      for(std::size_t t = 0; t < thread_count; ++t){
+        threads.emplace_back([&counter, iterations](){
+          for(std::size_t i = 0; i < iterations; ++i){
+            const auto state = Lock::lock();
+            counter = counter + 1;
+            Lock::unlock(state);
+          }
+        });
+      }
+      for(auto& thread : threads){
+        thread.join();
+      }
+      return counter;
+    }
+}
+
+TEMPLATE_TEST_CASE("Lock policy : mutual exclusion","[embtl][template][lock][thread]",
+        (embtl::lock::primask_lock),
+        (embtl::lock::basepri_lock<0x40>),
+        (embtl::lock::spin_lock<uut_lock_tag>),
+        (embtl::lock::mutex_lock<uut_lock_tag>)
+){
+  constexpr std::size_t thread_count = 4;
+  constexpr std::size_t iterations = 10'000;
+
+  STATIC_REQUIRE(embtl::register_lock_policy<TestType>);
+  REQUIRE(locked_count<TestType>(thread_count, iterations) == (thread_count * iterations));
+}
+
+TEST_CASE("Lock policy : no lock","[embtl][lock]"){
+  STATIC_REQUIRE(embtl::register_lock_policy<embtl::lock::no_lock>);
+  STATIC_REQUIRE(embtl::lock::no_lock::lock() == false);
+}
+
+TEST_CASE("Lock policy : interrupt mask nesting","[embtl][lock][primask][basepri]"){
+  using mask_t = embtl::lock::details::host_interrupt_mask;
+
+  REQUIRE_FALSE(mask_t::is_masked());
+
+  const auto outer = embtl::lock::primask_lock::lock();
+  REQUIRE(mask_t::is_masked());
+
+  // A nested lock does not take the simulated interrupt mask again.
+  const auto inner = embtl::lock::basepri_lock<0x80>::lock();
+  embtl::lock::basepri_lock<0x80>::unlock(inner);
+  REQUIRE(mask_t::is_masked());
+
+  embtl::lock::primask_lock::unlock(outer);
+  REQUIRE_FALSE(mask_t::is_masked());
+}
@@ -149,3 +149,442 @@ TEMPLATE_TEST_CASE_SIG("Register Access policy : Read/Write","[embtl][template][
     }
   }
 }
+
+struct shadow_side_effect final {
+  public:
+    static void read(volatile embtl::arch_type&){
+      ++reads;
+    }
+    static void write(volatile embtl::arch_type& reg, const embtl::arch_type& value){
+      ++writes;
+      reg = value;
+    }
+    static void write(volatile embtl::arch_type& reg, embtl::arch_type&& value){
+      ++writes;
+      reg = value;
+    }
+
+    inline static std::size_t reads { 0 };
+    inline static std::size_t writes { 0 };
+};
+
+TEMPLATE_TEST_CASE_SIG("Register Access policy : Write-only shadowed","[embtl][template][policy][register][write-only][shadow][static]",
+                       ((typename RegisterType, embtl::arch_type RegisterMask, embtl::arch_type RegisterReset), RegisterType, RegisterMask, RegisterReset),
+                       (embtl::arch_type, std::numeric_limits<embtl::arch_type>::max(), 0x0000'0000),
+                       (embtl::arch_type, 0xFF00'0000, 0x1200'0000),
+                       (embtl::arch_type, 0x0000'FF00, 0x0000'AB00),
+                       (embtl::arch_type, 0x03C0'7800, 0xFFFF'FFFF)
+){
+  using reg_sh_t = embtl::policy::basic_reg_write_only_shadowed<RegisterType, RegisterMask, RegisterReset, 4, shadow_side_effect>;
+
+  SECTION("Concept Tests"){
+    STATIC_REQUIRE(embtl::mmio_register_policy_read_only<reg_sh_t>);
+    STATIC_REQUIRE(embtl::mmio_register_policy_write_only<reg_sh_t>);
+    STATIC_REQUIRE(embtl::mmio_register_policy_read_write<reg_sh_t>);
+  }
+  SECTION("Static Methods"){
+    volatile RegisterType sh_reg { 0 };
+
+    SECTION("reset value"){
+      // Shadow copy of a register that has not been written starts at the reset value.
+      static volatile RegisterType unwritten_reg { 0 };
+      REQUIRE(reg_sh_t::read(unwritten_reg) == (RegisterReset & RegisterMask));
+      STATIC_REQUIRE(reg_sh_t::reset_value == RegisterReset);
+    }
+    SECTION("Shadow copy per register"){
+      static volatile RegisterType other_reg { 0 };
+      reg_sh_t::write(sh_reg, RegisterMask);
+      reg_sh_t::write(other_reg, 0);
+      REQUIRE(reg_sh_t::read(sh_reg) == RegisterMask);
+      REQUIRE(reg_sh_t::read(other_reg) == 0);
+    }
+    SECTION("Read/Write Methods"){
+      auto init_value = GENERATE(take(5, random(std::numeric_limits<RegisterType>::min(), std::numeric_limits<RegisterType>::max())));
+      auto wr_value = GENERATE(take(5, random(std::numeric_limits<RegisterType>::min(), std::numeric_limits<RegisterType>::max())));
+      auto position = GENERATE(take(3, random(static_cast<std::size_t>(0), static_cast<std::size_t>(23))));
+      auto sz = GENERATE(take(3, random(static_cast<std::size_t>(1), static_cast<std::size_t>(8))));
+
+      reg_sh_t::write(sh_reg, init_value);
+      auto reads = shadow_side_effect::reads;
+      auto writes = shadow_side_effect::writes;
+
+      SECTION("write/read"){
+        REQUIRE(sh_reg == (init_value & RegisterMask));
+        REQUIRE(reg_sh_t::read(sh_reg) == (init_value & RegisterMask));
+        REQUIRE(reg_sh_t::get_field(sh_reg, position, sz) == ((init_value & RegisterMask & embtl::make_mask<RegisterType>(position, sz)) >> position));
+      }
+      SECTION("set_field"){
+        auto value_check = (init_value & RegisterMask) & ~embtl::make_mask<RegisterType>(position, sz);
+        value_check |= (wr_value & embtl::make_mask<RegisterType>(0, sz)) << position;
+
+        reg_sh_t::set_field(sh_reg, position, sz, wr_value);
+        REQUIRE(sh_reg == (value_check & RegisterMask));
+        REQUIRE(reg_sh_t::read(sh_reg) == (value_check & RegisterMask));
+        REQUIRE(shadow_side_effect::writes == (writes + 1));
+      }
+      SECTION("clear_field"){
+        auto value_check = (init_value & RegisterMask) & ~embtl::make_mask<RegisterType>(position, sz);
+
+        reg_sh_t::clear_field(sh_reg, position, sz);
+        REQUIRE(sh_reg == value_check);
+        REQUIRE(reg_sh_t::read(sh_reg) == value_check);
+        REQUIRE(shadow_side_effect::writes == (writes + 1));
+      }
+      // Register is never read.
+      REQUIRE(shadow_side_effect::reads == reads);
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE("Register Access policy : Read/Write aliased","[embtl][template][policy][register][read-write][aliased][static]",
+        (embtl::arch_type)
+){
+  // Register block : REG, SET alias (+0x04), CLR alias (+0x08), XOR alias (+0x0C).
+  using reg_alias_t = embtl::policy::basic_reg_read_write_aliased<TestType, 0x04, 0x08, 0x0C, std::numeric_limits<TestType>::max(), void, false>;
+  using reg_sim_t = embtl::policy::basic_reg_read_write_aliased<TestType, 0x04, 0x08, 0x0C, std::numeric_limits<TestType>::max(), void, true>;
+
+  SECTION("Concept Tests"){
+    STATIC_REQUIRE(embtl::mmio_register_policy_read_write<reg_alias_t>);
+    STATIC_REQUIRE(embtl::mmio_register_policy_atomic_bits<reg_alias_t>);
+    STATIC_REQUIRE(embtl::mmio_register_policy_atomic_bits<reg_sim_t>);
+    STATIC_REQUIRE_FALSE(embtl::mmio_register_policy_atomic_bits<embtl::policy::basic_reg_read_write<TestType>>);
+  }
+  SECTION("Static Methods"){
+    auto init_value = GENERATE(take(5, random(std::numeric_limits<TestType>::min(), std::numeric_limits<TestType>::max())));
+    auto bits = GENERATE(take(5, random(std::numeric_limits<TestType>::min(), std::numeric_limits<TestType>::max())));
+    auto position = GENERATE(take(3, random(static_cast<std::size_t>(0), static_cast<std::size_t>(23))));
+    auto sz = GENERATE(take(3, random(static_cast<std::size_t>(1), static_cast<std::size_t>(8))));
+
+    SECTION("Alias stores"){
+      struct alias_block { TestType reg; TestType set; TestType clr; TestType xr; };
+      volatile alias_block block { init_value, 0, 0, 0 };
+      auto& reg = block.reg;
+      auto& set_alias = block.set;
+      auto& clr_alias = block.clr;
+      auto& xor_alias = block.xr;
+
+      SECTION("set_bits"){
+        reg_alias_t::set_bits(reg, bits);
+        REQUIRE(set_alias == bits);
+        REQUIRE(clr_alias == 0);
+        REQUIRE(xor_alias == 0);
+      }
+      SECTION("clear_bits"){
+        reg_alias_t::clear_bits(reg, bits);
+        REQUIRE(set_alias == 0);
+        REQUIRE(clr_alias == bits);
+        REQUIRE(xor_alias == 0);
+      }
+      SECTION("toggle_bits"){
+        reg_alias_t::toggle_bits(reg, bits);
+        REQUIRE(set_alias == 0);
+        REQUIRE(clr_alias == 0);
+        REQUIRE(xor_alias == bits);
+      }
+      SECTION("set_field"){
+        auto field_mask = embtl::make_mask<TestType>(position, sz);
+        auto field_bits = static_cast<TestType>((bits & embtl::make_mask<TestType>(0, sz)) << position);
+
+        reg_alias_t::set_field(reg, position, sz, bits);
+        REQUIRE(set_alias == field_bits);
+        REQUIRE(clr_alias == static_cast<TestType>(field_mask & ~field_bits));
+        REQUIRE(xor_alias == 0);
+      }
+      SECTION("clear_field"){
+        reg_alias_t::clear_field(reg, position, sz);
+        REQUIRE(set_alias == 0);
+        REQUIRE(clr_alias == embtl::make_mask<TestType>(position, sz));
+        REQUIRE(xor_alias == 0);
+      }
+      // Register is never written directly.
+      REQUIRE(reg == init_value);
+    }
+    SECTION("Simulated"){
+      volatile TestType reg { init_value };
+
+      SECTION("set_bits"){
+        reg_sim_t::set_bits(reg, bits);
+        REQUIRE(reg == static_cast<TestType>(init_value | bits));
+      }
+      SECTION("clear_bits"){
+        reg_sim_t::clear_bits(reg, bits);
+        REQUIRE(reg == static_cast<TestType>(init_value & ~bits));
+      }
+      SECTION("toggle_bits"){
+        reg_sim_t::toggle_bits(reg, bits);
+        REQUIRE(reg == static_cast<TestType>(init_value ^ bits));
+      }
+      SECTION("set_field"){
+        auto value_check = init_value & ~embtl::make_mask<TestType>(position, sz);
+        value_check |= (bits & embtl::make_mask<TestType>(0, sz)) << position;
+
+        reg_sim_t::set_field(reg, position, sz, bits);
+        REQUIRE(reg == value_check);
+      }
+      SECTION("clear_field"){
+        reg_sim_t::clear_field(reg, position, sz);
+        REQUIRE(reg == static_cast<TestType>(init_value & ~embtl::make_mask<TestType>(position, sz)));
+      }
+    }
+  }
+}
+
+struct w1c_side_effect final {
+  public:
+    static void read(volatile embtl::arch_type&){
+      ++reads;
+    }
+    static void write(volatile embtl::arch_type& reg, const embtl::arch_type& value){
+      ++writes;
+      reg = reg & ~value;
+    }
+    static void write(volatile embtl::arch_type& reg, embtl::arch_type&& value){
+      ++writes;
+      reg = reg & ~value;
+    }
+
+    inline static std::size_t reads { 0 };
+    inline static std::size_t writes { 0 };
+};
+
+TEMPLATE_TEST_CASE_SIG("Register Access policy : Write-one-to-clear","[embtl][template][policy][register][w1c][static]",
+                       ((typename RegisterType, embtl::arch_type RegisterMask), RegisterType, RegisterMask),
+                       (embtl::arch_type, std::numeric_limits<embtl::arch_type>::max()),
+                       (embtl::arch_type, 0x0000'FFFF)
+){
+  using reg_w1c_t = embtl::policy::basic_reg_write_1_clear<RegisterType, RegisterMask, void, false>;
+  using reg_sim_t = embtl::policy::basic_reg_write_1_clear<RegisterType, RegisterMask, void, true>;
+  using reg_cnt_t = embtl::policy::basic_reg_write_1_clear<RegisterType, RegisterMask, w1c_side_effect>;
+
+  SECTION("Concept Tests"){
+    STATIC_REQUIRE(embtl::mmio_register_policy_read_only<reg_w1c_t>);
+    STATIC_REQUIRE(embtl::mmio_register_policy_write_only<reg_w1c_t>);
+    STATIC_REQUIRE(embtl::mmio_register_policy_write_1_clear<reg_w1c_t>);
+    STATIC_REQUIRE_FALSE(embtl::mmio_register_policy_read_write<reg_w1c_t>);
+    STATIC_REQUIRE_FALSE(embtl::mmio_register_policy_write_1_clear<embtl::policy::basic_reg_read_write<RegisterType>>);
+  }
+  SECTION("Static Methods"){
+    auto init_value = GENERATE(take(5, random(std::numeric_limits<RegisterType>::min(), std::numeric_limits<RegisterType>::max())));
+    auto bits = GENERATE(take(5, random(std::numeric_limits<RegisterType>::min(), std::numeric_limits<RegisterType>::max())));
+    auto position = GENERATE(take(3, random(static_cast<std::size_t>(0), static_cast<std::size_t>(23))));
+    auto sz = GENERATE(take(3, random(static_cast<std::size_t>(1), static_cast<std::size_t>(8))));
+
+    volatile RegisterType reg { init_value };
+
+    SECTION("Store"){
+      SECTION("clear_bits"){
+        reg_w1c_t::clear_bits(reg, bits);
+        REQUIRE(reg == (bits & RegisterMask));
+      }
+      SECTION("clear_field"){
+        reg_w1c_t::clear_field(reg, position, sz);
+        REQUIRE(reg == (embtl::make_mask<RegisterType>(position, sz) & RegisterMask));
+      }
+    }
+    SECTION("Simulated"){
+      SECTION("clear_bits"){
+        reg_sim_t::clear_bits(reg, bits);
+        REQUIRE(reg == (init_value & ~(bits & RegisterMask)));
+      }
+      SECTION("clear_field"){
+        reg_sim_t::clear_field(reg, position, sz);
+        REQUIRE(reg == (init_value & ~(embtl::make_mask<RegisterType>(position, sz) & RegisterMask)));
+      }
+    }
+    SECTION("Single access"){
+      auto reads = w1c_side_effect::reads;
+      auto writes = w1c_side_effect::writes;
+
+      reg_cnt_t::clear_field(reg, position, sz);
+      REQUIRE(reg == (init_value & ~(embtl::make_mask<RegisterType>(position, sz) & RegisterMask)));
+      // Other pending flags are not cleared and the register is not read.
+      REQUIRE(w1c_side_effect::reads == reads);
+      REQUIRE(w1c_side_effect::writes == (writes + 1));
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE("Register Access policy : Read-to-clear","[embtl][template][policy][register][r2c][static]",
+        (embtl::arch_type)
+){
+  using reg_r2c_t = embtl::policy::basic_reg_read_clear<TestType, void, false>;
+  using reg_sim_t = embtl::policy::basic_reg_read_clear<TestType, void, true>;
+
+  SECTION("Concept Tests"){
+    STATIC_REQUIRE(embtl::mmio_register_policy_read_only<reg_r2c_t>);
+    STATIC_REQUIRE(embtl::mmio_register_policy_read_clear<reg_r2c_t>);
+    STATIC_REQUIRE_FALSE(embtl::mmio_register_policy_write_only<reg_r2c_t>);
+    STATIC_REQUIRE_FALSE(embtl::mmio_register_policy_read_clear<embtl::policy::basic_reg_read_only<TestType>>);
+  }
+  SECTION("Static Methods"){
+    auto init_value = GENERATE(take(5, random(std::numeric_limits<TestType>::min(), std::numeric_limits<TestType>::max())));
+    auto position = GENERATE(take(3, random(static_cast<std::size_t>(0), static_cast<std::size_t>(23))));
+    auto sz = GENERATE(take(3, random(static_cast<std::size_t>(1), static_cast<std::size_t>(8))));
+
+    volatile TestType reg { init_value };
+
+    SECTION("read"){
+      REQUIRE(reg_r2c_t::read(reg) == init_value);
+      REQUIRE(reg == init_value);
+      REQUIRE(reg_sim_t::read(reg) == init_value);
+      REQUIRE(reg == 0);
+    }
+    SECTION("get_field"){
+      auto field = (init_value & embtl::make_mask<TestType>(position, sz)) >> position;
+      REQUIRE(reg_sim_t::get_field(reg, position, sz) == field);
+      REQUIRE(reg == 0);
+    }
+    SECTION("clear"){
+      reg_sim_t::clear(reg);
+      REQUIRE(reg == 0);
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG("Register Access policy : Read/Write atomic","[embtl][template][policy][register][read-write][atomic][static]",
+                       ((typename RegisterType, embtl::arch_type RegisterMask), RegisterType, RegisterMask),
+                       (embtl::arch_type, std::numeric_limits<embtl::arch_type>::max()),
+                       (embtl::arch_type, 0x0F0F'FFFF)
+){
+  using reg_atomic_t = embtl::policy::basic_reg_read_write_atomic<RegisterType, RegisterMask>;
+
+  SECTION("Concept Tests"){
+    STATIC_REQUIRE(embtl::mmio_register_policy_read_write<reg_atomic_t>);
+    STATIC_REQUIRE(embtl::mmio_register_policy_atomic_bits<reg_atomic_t>);
+    STATIC_REQUIRE(embtl::mmio_register_policy_atomic_modify<reg_atomic_t>);
+    STATIC_REQUIRE_FALSE(embtl::mmio_register_policy_atomic_modify<embtl::policy::basic_reg_read_write<RegisterType>>);
+  }
+  SECTION("Static Methods"){
+    auto init_value = GENERATE(take(5, random(std::numeric_limits<RegisterType>::min(), std::numeric_limits<RegisterType>::max())));
+    auto bits = GENERATE(take(5, random(std::numeric_limits<RegisterType>::min(), std::numeric_limits<RegisterType>::max())));
+    auto position = GENERATE(take(3, random(static_cast<std::size_t>(0), static_cast<std::size_t>(23))));
+    auto sz = GENERATE(take(3, random(static_cast<std::size_t>(1), static_cast<std::size_t>(8))));
+
+    volatile RegisterType reg { init_value };
+
+    SECTION("read/write"){
+      REQUIRE(reg_atomic_t::read(reg) == init_value);
+      reg_atomic_t::write(reg, bits);
+      REQUIRE(reg == (bits & RegisterMask));
+    }
+    SECTION("set_bits"){
+      reg_atomic_t::set_bits(reg, bits);
+      REQUIRE(reg == (init_value | (bits & RegisterMask)));
+    }
+    SECTION("clear_bits"){
+      reg_atomic_t::clear_bits(reg, bits);
+      REQUIRE(reg == (init_value & ~(bits & RegisterMask)));
+    }
+    SECTION("toggle_bits"){
+      reg_atomic_t::toggle_bits(reg, bits);
+      REQUIRE(reg == (init_value ^ (bits & RegisterMask)));
+    }
+    SECTION("set_field"){
+      auto field_mask = embtl::make_mask<RegisterType>(position, sz) & RegisterMask;
+      auto value_check = init_value & ~field_mask;
+      value_check |= ((bits & embtl::make_mask<RegisterType>(0, sz)) << position) & RegisterMask;
+
+      reg_atomic_t::set_field(reg, position, sz, bits);
+      REQUIRE(reg == value_check);
+      REQUIRE(reg_atomic_t::get_field(reg, position, sz) == ((value_check & embtl::make_mask<RegisterType>(position, sz)) >> position));
+    }
+    SECTION("clear_field"){
+      reg_atomic_t::clear_field(reg, position, sz);
+      REQUIRE(reg == (init_value & ~(embtl::make_mask<RegisterType>(position, sz) & RegisterMask)));
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE("Register Access policy : Read/Write with lock","[embtl][template][policy][register][read-write][lock][static]",
+        (embtl::lock::primask_lock),
+        (embtl::lock::spin_lock<>),
+        (embtl::lock::mutex_lock<>)
+){
+  using reg_lock_t = embtl::policy::basic_reg_read_write<embtl::arch_type, std::numeric_limits<embtl::arch_type>::max(), void, false, TestType>;
+
+  SECTION("Concept Tests"){
+    STATIC_REQUIRE(embtl::mmio_register_policy_read_write<reg_lock_t>);
+    STATIC_REQUIRE(embtl::mmio_register_policy_atomic_modify<reg_lock_t>);
+    STATIC_REQUIRE(std::is_same_v<typename reg_lock_t::lock_type, TestType>);
+  }
+  SECTION("Static Methods"){
+    auto init_value = GENERATE(take(5, random(std::numeric_limits<embtl::arch_type>::min(), std::numeric_limits<embtl::arch_type>::max())));
+    auto bits = GENERATE(take(5, random(std::numeric_limits<embtl::arch_type>::min(), std::numeric_limits<embtl::arch_type>::max())));
+
+    volatile embtl::arch_type reg { init_value };
+
+    SECTION("set_bits"){
+      reg_lock_t::set_bits(reg, bits);
+      REQUIRE(reg == (init_value | bits));
+    }
+    SECTION("clear_bits"){
+      reg_lock_t::clear_bits(reg, bits);
+      REQUIRE(reg == (init_value & ~bits));
+    }
+    SECTION("toggle_bits"){
+      reg_lock_t::toggle_bits(reg, bits);
+      REQUIRE(reg == (init_value ^ bits));
+    }
+    SECTION("modify"){
+      reg_lock_t::modify(reg, 0x0000'FF00U, bits & 0x0000'FF00U);
+      REQUIRE(reg == ((init_value & ~0x0000'FF00U) | (bits & 0x0000'FF00U)));
+    }
+    SECTION("set_field/clear_field"){
+      reg_lock_t::set_field(reg, 8, 8, bits);
+      REQUIRE(reg == ((init_value & ~0x0000'FF00U) | ((bits & 0xFFU) << 8)));
+      reg_lock_t::clear_field(reg, 8, 8);
+      REQUIRE(reg == (init_value & ~0x0000'FF00U));
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE("Register Access policy : narrow register width","[embtl][template][policy][register][width][static]",
+        (std::uint8_t), (std::uint16_t)
+){
+  using reg_ro_t = embtl::policy::basic_reg_read_only<TestType>;
+  using reg_wo_t = embtl::policy::basic_reg_write_only<TestType>;
+  using reg_rw_t = embtl::policy::basic_reg_read_write<TestType>;
+
+  SECTION("Concept Tests"){
+    STATIC_REQUIRE(embtl::mmio_register_policy_read_only<reg_ro_t>);
+    STATIC_REQUIRE(embtl::mmio_register_policy_read_only<reg_ro_t, TestType>);
+    STATIC_REQUIRE_FALSE(embtl::mmio_register_policy_read_only<reg_ro_t, embtl::arch_type>);
+    STATIC_REQUIRE(embtl::mmio_register_policy_write_only<reg_wo_t>);
+    STATIC_REQUIRE(embtl::mmio_register_policy_read_write<reg_rw_t>);
+    STATIC_REQUIRE(embtl::mmio_register_policy_atomic_bits<embtl::policy::basic_reg_read_write_aliased<TestType, 0x4, 0x8, 0xC>>);
+    STATIC_REQUIRE(embtl::mmio_register_policy_atomic_modify<embtl::policy::basic_reg_read_write_atomic<TestType>>);
+    STATIC_REQUIRE(embtl::mmio_register_policy_write_1_clear<embtl::policy::basic_reg_write_1_clear<TestType>>);
+    STATIC_REQUIRE(embtl::mmio_register_policy_read_clear<embtl::policy::basic_reg_read_clear<TestType>>);
+    STATIC_REQUIRE(std::is_same_v<embtl::policy_value_t<reg_rw_t>, TestType>);
+  }
+  SECTION("Static Methods"){
+    // Register between two neighbours, accesses must not change the neighbouring registers.
+    struct register_block { TestType before; TestType reg; TestType after; };
+
+    const auto init_value = static_cast<TestType>(GENERATE(take(5, random(0U, 0xFFFFU))));
+    const auto wr_value = static_cast<TestType>(GENERATE(take(5, random(0U, 0xFFFFU))));
+    const auto position = GENERATE(take(3, random(static_cast<std::size_t>(0), static_cast<std::size_t>(std::numeric_limits<TestType>::digits - 4))));
+
+    volatile register_block block { 0xA5, init_value, 0x5A };
+
+    SECTION("read/write"){
+      REQUIRE(reg_rw_t::read(block.reg) == init_value);
+      reg_rw_t::write(block.reg, wr_value);
+      REQUIRE(block.reg == wr_value);
+    }
+    SECTION("set_field"){
+      auto value_check = static_cast<TestType>(init_value & ~embtl::make_mask<TestType>(position, 4));
+      value_check = static_cast<TestType>(value_check | ((wr_value & 0xFU) << position));
+
+      reg_rw_t::set_field(block.reg, position, 4, wr_value);
+      REQUIRE(block.reg == value_check);
+      REQUIRE(reg_rw_t::get_field(block.reg, position, 4) == (wr_value & 0xFU));
+    }
+    SECTION("clear_field"){
+      reg_rw_t::clear_field(block.reg, position, 4);
+      REQUIRE(block.reg == (init_value & ~embtl::make_mask<TestType>(position, 4)));
+    }
+    REQUIRE(block.before == 0xA5);
+    REQUIRE(block.after == 0x5A);
+  }
+}
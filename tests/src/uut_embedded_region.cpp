@@ -8,10 +8,13 @@
  * @version v0.1.0
  * @copyright Copyright (c) 2024
  */
+#include <algorithm>
+#include <vector>
 #include <uut_catch2.hpp>
 #include <embedded_allocator.hpp>
 #include <embedded_register.hpp>
 #include <embedded_region.hpp>
+#include <embedded_register_array.hpp>
 
 using reg_ro_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_only<embtl::arch_type>>;
 using reg_wo_t = embtl::basic_hardware_register<embtl::policy::basic_reg_write_only<embtl::arch_type>>;
@@ -98,3 +101,152 @@ TEMPLATE_TEST_CASE_SIG("basic_mmio_device_registers<> template single test","[em
   }
 
 }
+
+namespace {
+    using reg_masked_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_write<embtl::arch_type>, embtl::arch_type, 0x0000'FFFF>;
+    using reg_res_t = embtl::basic_hardware_register<embtl::policy::basic_reg_reserved<embtl::arch_type>>;
+    using reg_r2c_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_clear<embtl::arch_type>>;
+    using reg_w1c_t = embtl::basic_hardware_register<embtl::policy::basic_reg_write_1_clear<embtl::arch_type>>;
+
+    struct lp_channel_registers_t {
+        reg_rw_t CFG;
+        reg_ro_t STAT;
+    };
+
+    struct lp_registers_t {
+        reg_rw_t      CTRL;
+        reg_masked_t  BAUD;
+        reg_ro_t      STAT;
+        reg_wo_t      TX;
+        reg_res_t     RES;
+        reg_r2c_t     ERR;
+        reg_w1c_t     FLAGS;
+        embtl::register_array<reg_rw_t, 4> CCR;
+        embtl::register_block_array<lp_channel_registers_t, 2> CH;
+    };
+
+    /**
+     * @brief Sets the raw value of every register of the map, value + register index.
+     */
+    template<typename Map>
+    void fill_registers(Map& map, const embtl::arch_type value){
+      embtl::arch_type index = 0;
+      auto fill = [&index, value](auto& reg){
+        using reg_type = std::remove_cvref_t<decltype(reg)>;
+        reg_type::set_register(reg, value + index++);
+      };
+      embtl::details::for_each_register(static_cast<lp_registers_t&>(map), fill);
+    }
+}
+
+namespace {
+    struct single_member_t {
+        std::uint8_t m0;
+    };
+
+    struct max_members_t {
+        std::uint8_t m0, m1, m2, m3, m4, m5, m6, m7;
+        std::uint8_t m8, m9, m10, m11, m12, m13, m14, m15;
+        std::uint8_t m16, m17, m18, m19, m20, m21, m22, m23;
+        std::uint8_t m24, m25, m26, m27, m28, m29, m30, m31;
+        std::uint8_t m32, m33, m34, m35, m36, m37, m38, m39;
+        std::uint8_t m40, m41, m42, m43, m44, m45, m46, m47;
+        std::uint8_t m48, m49, m50, m51, m52, m53, m54, m55;
+        std::uint8_t m56, m57, m58, m59, m60, m61, m62, m63;
+    };
+}
+
+TEST_CASE("for_each_member() function test", "[embtl][function][for_each_member]"){
+  STATIC_REQUIRE(embtl::aggregate_member_count_v<single_member_t> == 1);
+  STATIC_REQUIRE(embtl::aggregate_member_count_v<max_members_t> == embtl::max_aggregate_members);
+
+  SECTION("Single member"){
+    single_member_t item { };
+    std::size_t count = 0;
+    embtl::for_each_member(item, [&count](auto& member){ member = 0x5AU; ++count; });
+
+    REQUIRE(count == 1);
+    REQUIRE(item.m0 == 0x5AU);
+  }
+  SECTION("Maximum members, declaration order"){
+    max_members_t item { };
+    std::vector<const void*> visited;
+    embtl::for_each_member(item, [&visited](auto& member){ visited.push_back(&member); });
+
+    REQUIRE(visited.size() == embtl::max_aggregate_members);
+    REQUIRE(visited.front() == &item.m0);
+    REQUIRE(visited[31] == &item.m31);
+    REQUIRE(visited.back() == &item.m63);
+    REQUIRE(std::is_sorted(visited.begin(), visited.end(), std::less<>{}));
+  }
+}
+
+TEST_CASE("register_snapshot<> template test", "[embtl][template][snapshot]"){
+  using allocator_t = embtl::basic_mmio_single_device_allocator<{0x4000'0000}>;
+  using lp_device_registers_t = embtl::basic_mmio_device_registers<lp_registers_t, allocator_t>;
+  using lp_device_region_t = embtl::basic_device_region<lp_registers_t, allocator_t>;
+
+  STATIC_REQUIRE(embtl::aggregate_member_count_v<lp_registers_t> == 9);
+  STATIC_REQUIRE(embtl::aggregate_member_count_v<lp_channel_registers_t> == 2);
+  STATIC_REQUIRE(sizeof(embtl::register_snapshot<lp_registers_t>) == sizeof(lp_registers_t));
+
+  auto init_value = GENERATE(take(10, random(0x0000'0000U, 0x7FFF'FFFFU)));
+  auto new_value = GENERATE(take(5, random(0x8000'0000U, 0xFFFF'FFF0U)));
+
+  SECTION("register visit order"){
+    lp_registers_t regs { };
+    std::vector<const volatile void*> visited;
+    auto visit = [&visited](auto& reg){ visited.push_back(&reg); };
+    embtl::details::for_each_register(regs, visit);
+
+    REQUIRE(visited.size() == 15);
+    REQUIRE(visited.front() == &regs.CTRL);
+    REQUIRE(visited[7] == &regs.CCR[0]);
+    REQUIRE(visited[11] == &regs.CH[0].CFG);
+    REQUIRE(visited.back() == &regs.CH[1].STAT);
+  }
+  SECTION("basic_mmio_device_registers<> snapshot and restore"){
+    lp_device_registers_t regs { };
+    fill_registers(regs, init_value);
+
+    const auto saved = regs.snapshot();
+
+    REQUIRE(saved.get<&lp_registers_t::CTRL>() == init_value);
+    REQUIRE(saved.get<&lp_registers_t::BAUD>() == init_value + 1);
+    REQUIRE(saved.get<&lp_registers_t::STAT>() == init_value + 2);
+    REQUIRE(saved.get<&lp_registers_t::TX>() == 0);
+    REQUIRE(saved.get<&lp_registers_t::RES>() == 0);
+    REQUIRE(saved.get<&lp_registers_t::ERR>() == 0);
+    REQUIRE(saved.get<&lp_registers_t::FLAGS>() == init_value + 6);
+    REQUIRE(reg_r2c_t::get_register(regs.ERR) == init_value + 5);
+
+    fill_registers(regs, new_value);
+    regs.restore(saved);
+
+    REQUIRE(reg_rw_t::get_register(regs.CTRL) == init_value);
+    REQUIRE(reg_masked_t::get_register(regs.BAUD) == ((init_value + 1) & 0x0000'FFFF));
+    REQUIRE(reg_ro_t::get_register(regs.STAT) == new_value + 2);
+    REQUIRE(reg_wo_t::get_register(regs.TX) == new_value + 3);
+    REQUIRE(reg_res_t::get_register(regs.RES) == new_value + 4);
+    REQUIRE(reg_r2c_t::get_register(regs.ERR) == new_value + 5);
+    REQUIRE(reg_w1c_t::get_register(regs.FLAGS) == new_value + 6);
+    for(std::size_t i = 0; i < regs.CCR.size(); ++i){
+      REQUIRE(reg_rw_t::get_register(regs.CCR[i]) == init_value + 7 + i);
+    }
+    REQUIRE(reg_rw_t::get_register(regs.CH[0].CFG) == init_value + 11);
+    REQUIRE(reg_ro_t::get_register(regs.CH[0].STAT) == new_value + 12);
+    REQUIRE(reg_rw_t::get_register(regs.CH[1].CFG) == init_value + 13);
+    REQUIRE(reg_ro_t::get_register(regs.CH[1].STAT) == new_value + 14);
+  }
+  SECTION("basic_device_region<> modified snapshot"){
+    lp_device_region_t regs { };
+    fill_registers(regs, init_value);
+
+    auto saved = regs.snapshot();
+    saved.set<&lp_registers_t::CTRL>(new_value);
+    regs.restore(saved);
+
+    REQUIRE(reg_rw_t::get_register(regs.CTRL) == new_value);
+    REQUIRE(reg_masked_t::get_register(regs.BAUD) == ((init_value + 1) & 0x0000'FFFF));
+  }
+}
@@ -11,6 +11,8 @@
 #include <uut_catch2.hpp>
 #include <embedded_register.hpp>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 using register_type = embtl::arch_type;
 constexpr auto DEFAULT_MASK { std::numeric_limits<register_type>::max() };
@@ -76,7 +78,8 @@ TEMPLATE_TEST_CASE_SIG("Embedded Register Template test",
                        (embtl::policy::basic_reg_read_write<register_type, DEFAULT_MASK>, register_type, DEFAULT_MASK, DEFAULT_RESET),
                        (embtl::policy::basic_reg_read_only<register_type, side_effect_ro>, register_type, DEFAULT_MASK, DEFAULT_RESET),
                        (embtl::policy::basic_reg_write_only<register_type, DEFAULT_MASK, side_effect_wo>, register_type, DEFAULT_MASK, SIDE_EFFECT_RESET_VALUE),
-                       (embtl::policy::basic_reg_read_write<register_type, DEFAULT_MASK, side_effect_rw>, register_type, DEFAULT_MASK, SIDE_EFFECT_RESET_VALUE)
+                       (embtl::policy::basic_reg_read_write<register_type, DEFAULT_MASK, side_effect_rw>, register_type, DEFAULT_MASK, SIDE_EFFECT_RESET_VALUE),
+                       (embtl::policy::basic_reg_read_write_aliased<register_type, 0x04, 0x08, 0x0C, DEFAULT_MASK, void, true>, register_type, DEFAULT_MASK, DEFAULT_RESET)
 ){
   using reg_t = embtl::basic_hardware_register<Policy, BaseType, Mask, Reset>;
 
@@ -345,4 +348,424 @@ TEMPLATE_TEST_CASE_SIG("Embedded Register Template test",
       }
     }
   }
-}
\ No newline at end of file
+}
+enum class field_mode : register_type {
+  INPUT = 0,
+  OUTPUT,
+  ALTERNATE,
+  ANALOG
+};
+
+TEMPLATE_TEST_CASE_SIG("Embedded Register compile time field test",
+                       "[embtl][register][template][field]",
+                       ((typename Policy, register_type Mask), Policy, Mask),
+                       (embtl::policy::basic_reg_read_only<register_type>, DEFAULT_MASK),
+                       (embtl::policy::basic_reg_read_write<register_type, DEFAULT_MASK>, DEFAULT_MASK),
+                       (embtl::policy::basic_reg_read_write<register_type, 0x00FF'FFFF>, 0x00FF'FFFF),
+                       (embtl::policy::basic_reg_read_write<register_type, DEFAULT_MASK, side_effect_rw>, DEFAULT_MASK)
+){
+  using reg_t = embtl::basic_hardware_register<Policy, register_type, Mask>;
+  using enable_t = embtl::field<0>;
+  using mode_field_t = embtl::field<4, 2, field_mode>;
+  using prescaler_t = embtl::field<8, 8>;
+
+  auto init_value = GENERATE(take(10, random(std::numeric_limits<register_type>::min(), std::numeric_limits<register_type>::max())));
+  reg_t uut_reg { };
+  reg_t::set_register(uut_reg, init_value & Mask);
+
+  SECTION("get method"){
+    REQUIRE(uut_reg.template get<enable_t>() == uut_reg.get_field(0));
+    REQUIRE(uut_reg.template get<mode_field_t>() == static_cast<field_mode>(uut_reg.get_field(4, 2)));
+    REQUIRE(uut_reg.template get<prescaler_t>() == uut_reg.get_field(8, 8));
+
+    const auto& c_reg = uut_reg;
+    REQUIRE(c_reg.template get<prescaler_t>() == c_reg.get_field(8, 8));
+  }
+  if constexpr (embtl::mmio_register_policy_read_write<Policy>){
+    auto field_value = GENERATE(take(5, random(std::numeric_limits<register_type>::min(), std::numeric_limits<register_type>::max())));
+
+    SECTION("set method"){
+      auto check = reg_t::get_register(uut_reg);
+      check &= ~embtl::make_mask<register_type>(8, 8);
+      check |= (field_value & 0xFFU) << 8;
+
+      uut_reg.template set<prescaler_t>(field_value);
+      REQUIRE(reg_t::get_register(uut_reg) == (check & Mask));
+
+      uut_reg.template set<mode_field_t>(field_mode::ANALOG);
+      REQUIRE(uut_reg.template get<mode_field_t>() == field_mode::ANALOG);
+      REQUIRE(uut_reg.template get<prescaler_t>() == (field_value & 0xFFU));
+    }
+    SECTION("clear method"){
+      auto check = reg_t::get_register(uut_reg) & ~embtl::make_mask<register_type>(4, 2);
+
+      uut_reg.template clear<mode_field_t>();
+      REQUIRE(reg_t::get_register(uut_reg) == check);
+      REQUIRE(uut_reg.template get<mode_field_t>() == field_mode::INPUT);
+    }
+  }
+}
+
+struct side_effect_counter final {
+  public:
+    static void read(volatile embtl::arch_type&){
+      ++reads;
+    }
+    static void write(volatile embtl::arch_type& reg, const embtl::arch_type& value){
+      ++writes;
+      reg = value;
+    }
+    static void write(volatile embtl::arch_type& reg, embtl::arch_type&& value){
+      ++writes;
+      reg = value;
+    }
+    static void reset() noexcept {
+      reads = 0;
+      writes = 0;
+    }
+
+    inline static std::size_t reads { 0 };
+    inline static std::size_t writes { 0 };
+};
+
+TEMPLATE_TEST_CASE_SIG("Embedded Register multiple field modify test",
+                       "[embtl][register][template][field][modify]",
+                       ((register_type Mask, register_type Reset), Mask, Reset),
+                       (DEFAULT_MASK, DEFAULT_RESET),
+                       (0x00FF'FFFF, 0x0000'0F00),
+                       (DEFAULT_MASK, 0x1234'5678)
+){
+  using reg_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_write<register_type, Mask, side_effect_counter>, register_type, Mask, Reset>;
+  using enable_t = embtl::field<0>;
+  using mode_field_t = embtl::field<4, 2, field_mode>;
+  using prescaler_t = embtl::field<8, 8>;
+
+  auto init_value = GENERATE(take(10, random(std::numeric_limits<register_type>::min(), std::numeric_limits<register_type>::max())));
+  auto prescaler = GENERATE(take(5, random(std::numeric_limits<register_type>::min(), std::numeric_limits<register_type>::max())));
+
+  reg_t uut_reg { };
+  reg_t::set_register(uut_reg, init_value & Mask);
+  side_effect_counter::reset();
+
+  SECTION("modify method"){
+    auto check = reg_t::get_register(uut_reg);
+    check &= ~embtl::static_mask<register_type, {0}, {4, 2}, {8, 8}>;
+    check |= 0x1U | (static_cast<register_type>(field_mode::ALTERNATE) << 4) | ((prescaler & 0xFFU) << 8);
+
+    uut_reg.modify(enable_t{} = 1, mode_field_t{} = field_mode::ALTERNATE, prescaler_t{} = prescaler);
+
+    REQUIRE(reg_t::get_register(uut_reg) == (check & Mask));
+    REQUIRE(side_effect_counter::reads == 1);
+    REQUIRE(side_effect_counter::writes == 1);
+  }
+  SECTION("write_fields method"){
+    auto check = Reset & ~embtl::static_mask<register_type, {4, 2}, {8, 8}>;
+    check |= (static_cast<register_type>(field_mode::OUTPUT) << 4) | ((prescaler & 0xFFU) << 8);
+
+    uut_reg.write_fields(mode_field_t{} = field_mode::OUTPUT, prescaler_t{} = prescaler);
+
+    REQUIRE(reg_t::get_register(uut_reg) == (check & Mask));
+    REQUIRE(side_effect_counter::reads == 0);
+    REQUIRE(side_effect_counter::writes == 1);
+  }
+}
+
+TEST_CASE("Embedded Register aliased policy test", "[embtl][register][field][aliased]"){
+  using policy_t = embtl::policy::basic_reg_read_write_aliased<register_type, 0x04, 0x08, 0x0C, DEFAULT_MASK, void, false>;
+  using reg_t = embtl::basic_hardware_register<policy_t, register_type>;
+  using enable_t = embtl::field<0>;
+  using mode_field_t = embtl::field<4, 2, field_mode>;
+
+  // Register followed by the SET, CLR and XOR alias registers.
+  struct alias_block {
+      reg_t REG;
+      volatile register_type SET;
+      volatile register_type CLR;
+      volatile register_type XOR;
+  };
+  STATIC_REQUIRE(sizeof(alias_block) == (4 * sizeof(register_type)));
+
+  auto init_value = GENERATE(take(10, random(std::numeric_limits<register_type>::min(), std::numeric_limits<register_type>::max())));
+  auto op_value = GENERATE(take(5, random(std::numeric_limits<register_type>::min(), std::numeric_limits<register_type>::max())));
+
+  alias_block block { };
+  reg_t::set_register(block.REG, init_value);
+
+  SECTION("OR assignment"){
+    block.REG |= op_value;
+    REQUIRE(block.SET == op_value);
+    REQUIRE(block.CLR == 0);
+  }
+  SECTION("AND assignment"){
+    block.REG &= op_value;
+    REQUIRE(block.CLR == ~op_value);
+    REQUIRE(block.SET == 0);
+  }
+  SECTION("XOR assignment"){
+    block.REG ^= op_value;
+    REQUIRE(block.XOR == op_value);
+  }
+  SECTION("modify method"){
+    block.REG.modify(enable_t{} = 1, mode_field_t{} = field_mode::OUTPUT);
+    REQUIRE(block.SET == (0x1U | (static_cast<register_type>(field_mode::OUTPUT) << 4)));
+    REQUIRE(block.CLR == (embtl::static_mask<register_type, {4, 2}> & ~(static_cast<register_type>(field_mode::OUTPUT) << 4)));
+  }
+  SECTION("clear method"){
+    block.REG.clear<mode_field_t>();
+    REQUIRE(block.CLR == embtl::static_mask<register_type, {4, 2}>);
+    REQUIRE(block.SET == 0);
+  }
+  // Register is only written through the alias registers.
+  REQUIRE(reg_t::get_register(block.REG) == init_value);
+}
+
+TEST_CASE("Embedded Register shadowed policy test", "[embtl][register][field][shadow]"){
+  using enable_t = embtl::field<0>;
+  using mode_field_t = embtl::field<4, 2, field_mode>;
+
+  // Write-only registers with one policy type, each register has its own shadow copy.
+  using cr_policy_t = embtl::policy::basic_reg_write_only_shadowed<register_type, std::numeric_limits<register_type>::max(), 0x0000'0100, 4>;
+  using cr1_t = embtl::basic_hardware_register<cr_policy_t, register_type>;
+  using cr2_t = cr1_t;
+
+  struct uart_pair {
+      cr1_t CR1;
+      cr2_t CR2;
+  };
+  static uart_pair uarts { };
+
+  STATIC_REQUIRE(cr1_t::ResetValue() == 0x0000'0100);
+
+  uarts.CR1.write(0x0000'00F0);
+  uarts.CR2.write(0x0000'0000);
+  uarts.CR2.set<enable_t>(1);
+  uarts.CR1.set<mode_field_t>(field_mode::ALTERNATE);
+
+  REQUIRE(cr2_t::get_register(uarts.CR2) == 0x0000'0001);
+  REQUIRE(cr1_t::get_register(uarts.CR1) == 0x0000'00E0);
+  REQUIRE(uarts.CR1.get<enable_t>() == 0);
+  REQUIRE(uarts.CR2.get<mode_field_t>() == static_cast<field_mode>(0));
+
+  SECTION("One register map, several devices"){
+    struct uart_map {
+        cr1_t CR;
+    };
+    static std::array<uart_map, 2> devices { };
+
+    REQUIRE(devices[1].CR.read() == 0x0000'0100);
+    devices[0].CR.reset();
+    devices[0].CR.set<enable_t>(1);
+    devices[1].CR.set<mode_field_t>(field_mode::ALTERNATE);
+
+    REQUIRE(cr1_t::get_register(devices[0].CR) == 0x0000'0101);
+    REQUIRE(cr1_t::get_register(devices[1].CR) == 0x0000'0120);
+    REQUIRE(devices[0].CR.get<mode_field_t>() == static_cast<field_mode>(0));
+  }
+}
+
+TEST_CASE("Embedded Register status clear test", "[embtl][register][field][w1c][r2c]"){
+  using overrun_t = embtl::field<3>;
+  using error_field_t = embtl::field<4, 4>;
+
+  auto init_value = GENERATE(take(10, random(std::numeric_limits<register_type>::min(), std::numeric_limits<register_type>::max())));
+  auto clear_value = GENERATE(take(5, random(std::numeric_limits<register_type>::min(), std::numeric_limits<register_type>::max())));
+
+  SECTION("Write-one-to-clear"){
+    using reg_t = embtl::basic_hardware_register<embtl::policy::basic_reg_write_1_clear<register_type>, register_type>;
+    reg_t uut_reg { };
+    reg_t::set_register(uut_reg, init_value);
+
+    STATIC_REQUIRE_FALSE(reg_t::has_read_write_access());
+
+    SECTION("clear method"){
+      uut_reg.clear(clear_value);
+      REQUIRE(reg_t::get_register(uut_reg) == (init_value & ~clear_value));
+    }
+    SECTION("clear field method"){
+      uut_reg.clear<error_field_t>();
+      REQUIRE(reg_t::get_register(uut_reg) == (init_value & ~embtl::static_mask<register_type, {4, 4}>));
+      uut_reg.clear_field(3);
+      REQUIRE(reg_t::get_register(uut_reg) == (init_value & ~embtl::static_mask<register_type, {3, 5}>));
+    }
+    SECTION("get method"){
+      REQUIRE(uut_reg.get<overrun_t>() == ((init_value >> 3) & 0x1U));
+      REQUIRE(reg_t::get_register(uut_reg) == init_value);
+    }
+  }
+  SECTION("Read-to-clear"){
+    using reg_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_clear<register_type>, register_type>;
+    reg_t uut_reg { };
+    reg_t::set_register(uut_reg, init_value);
+
+    STATIC_REQUIRE_FALSE(reg_t::has_write_access());
+
+    SECTION("get method"){
+      REQUIRE(uut_reg.get<error_field_t>() == ((init_value >> 4) & 0xFU));
+      REQUIRE(reg_t::get_register(uut_reg) == 0);
+    }
+    SECTION("clear method"){
+      uut_reg.clear();
+      REQUIRE(reg_t::get_register(uut_reg) == 0);
+    }
+  }
+}
+
+TEST_CASE("Embedded Register atomic policy test", "[embtl][register][field][atomic][thread]"){
+  using reg_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_write_atomic<register_type>, register_type>;
+  constexpr std::size_t thread_count = 4;
+  constexpr std::size_t iterations = 20'000;
+
+  reg_t uut_reg { 0U };
+  std::vector<std::thread> threads;
+
+  // Each thread updates its own byte, lost updates from other threads would corrupt the final value.
+  for(std::size_t t = 0; t < thread_count; ++t){
+    threads.emplace_back([&uut_reg, t](){
+      const auto pos = t * 8;
+      const auto bit = register_type { 0x1U } << pos;
+
+      for(std::size_t i = 0; i < iterations; ++i){
+        uut_reg |= bit;
+        uut_reg ^= bit;
+        uut_reg.set_field(pos + 1, 7, static_cast<register_type>(i & 0x7FU));
+      }
+      uut_reg.set_field(pos, 8, 0xA5U);
+    });
+  }
+  for(auto& thread : threads){
+    thread.join();
+  }
+
+  REQUIRE(uut_reg.read() == 0xA5A5'A5A5U);
+}
+
+TEST_CASE("Embedded Register narrow width test", "[embtl][register][width]"){
+  using ctrl8_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_write<std::uint8_t>, std::uint8_t>;
+  using data16_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_write<std::uint16_t>, std::uint16_t>;
+  using status8_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_only<std::uint8_t>, std::uint8_t>;
+  using mode_field_t = embtl::field<4, 2, field_mode>;
+
+  // Mixed width register map, no padding to the architecture width.
+  struct narrow_register_map {
+      ctrl8_t CTRL;
+      status8_t STATUS;
+      data16_t DATA;
+  };
+  STATIC_REQUIRE(sizeof(narrow_register_map) == 4);
+  STATIC_REQUIRE(ctrl8_t::has_read_write_access());
+  STATIC_REQUIRE(status8_t::has_read_access());
+  STATIC_REQUIRE_FALSE(status8_t::has_write_access());
+
+  auto init_value = GENERATE(take(10, random(std::numeric_limits<std::uint16_t>::min(), std::numeric_limits<std::uint16_t>::max())));
+
+  narrow_register_map map { };
+  data16_t::set_register(map.DATA, init_value);
+  status8_t::set_register(map.STATUS, 0x81);
+
+  map.CTRL.set<mode_field_t>(field_mode::ALTERNATE);
+  map.CTRL |= 0x01;
+  map.DATA.set_field(8, 8, 0x3C);
+
+  REQUIRE(map.CTRL.read() == 0x21);
+  REQUIRE(map.CTRL.get<mode_field_t>() == field_mode::ALTERNATE);
+  REQUIRE(map.STATUS.read() == 0x81);
+  REQUIRE(map.DATA.read() == ((init_value & 0x00FFU) | 0x3C00U));
+}
+
+struct side_effect_ready final {
+  public:
+    static void read(volatile embtl::arch_type& reg){
+      if(++reads == ready_after){
+        reg = reg | ready_value;
+      }
+    }
+    static void reset(const std::size_t after, const embtl::arch_type value) noexcept {
+      reads = 0;
+      ready_after = after;
+      ready_value = value;
+    }
+
+    inline static std::size_t reads { 0 };
+    inline static std::size_t ready_after { 0 };
+    inline static embtl::arch_type ready_value { 0 };
+};
+
+struct wait_counter_hook final {
+  public:
+    static std::uint32_t now() noexcept { return ticks += 10U; }
+    static void record(const std::size_t count, const std::uint32_t elapsed) noexcept {
+      iterations = count;
+      cycles = elapsed;
+    }
+
+    inline static std::uint32_t ticks { 0 };
+    inline static std::size_t iterations { 0 };
+    inline static std::uint32_t cycles { 0 };
+};
+
+TEST_CASE("Embedded Register wait test", "[embtl][register][field][wait]"){
+  using reg_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_only<register_type, side_effect_ready, true>, register_type>;
+  using ready_t = embtl::field<0>;
+  using state_t = embtl::field<4, 4>;
+  constexpr register_type error_bit = 0x8000'0000U;
+
+  auto ready_after = GENERATE(std::size_t { 1 }, std::size_t { 5 }, std::size_t { 100 });
+
+  reg_t uut_reg { };
+  reg_t::set_register(uut_reg, 0U);
+
+  SECTION("wait_until method"){
+    side_effect_ready::reset(ready_after, 0x31U);
+    auto result = uut_reg.wait_until<state_t>(3U, 100);
+    REQUIRE(result.get_status() == embtl::STATUS::OK);
+    REQUIRE(result.get_value() == 0x31U);
+    REQUIRE(side_effect_ready::reads == ready_after);
+  }
+  SECTION("wait_any method"){
+    side_effect_ready::reset(ready_after, 0x02U);
+    auto result = uut_reg.wait_any<embtl::wait::exponential_spin<4>>(0x03U, 100);
+    REQUIRE(result.get_status() == embtl::STATUS::OK);
+    REQUIRE(side_effect_ready::reads == ready_after);
+  }
+  SECTION("wait_all method"){
+    side_effect_ready::reset(ready_after, 0x03U);
+    auto result = uut_reg.wait_all<embtl::wait::yield>(0x03U, 100);
+    REQUIRE(result.get_status() == embtl::STATUS::OK);
+    REQUIRE(result.get_value() == 0x03U);
+  }
+  SECTION("timeout"){
+    side_effect_ready::reset(ready_after, 0x01U);
+    auto result = uut_reg.wait_until<ready_t>(1U, ready_after - 1);
+    REQUIRE(side_effect_ready::reads == std::max<std::size_t>(ready_after - 1, 1));
+    if(ready_after == 1){
+      REQUIRE(result.get_status() == embtl::STATUS::OK);
+    } else {
+      REQUIRE(result.get_status() == embtl::STATUS::TIMEOUT);
+      REQUIRE(result.has_error());
+      REQUIRE(result.get_value() == 0U);
+    }
+  }
+  SECTION("timeout is an error"){
+    side_effect_ready::reset(ready_after, 0x01U);
+    auto any_result = uut_reg.wait_any(0x02U, ready_after + 1);
+    auto all_result = uut_reg.wait_all(0x03U, ready_after + 1);
+    REQUIRE(any_result.get_status() == embtl::STATUS::TIMEOUT);
+    REQUIRE(any_result.has_error());
+    REQUIRE(any_result.get_value() == 0x01U);
+    REQUIRE(all_result.has_error());
+  }
+  SECTION("error mask"){
+    side_effect_ready::reset(ready_after, error_bit);
+    auto result = uut_reg.wait_all(0x01U, 1000, error_bit);
+    REQUIRE(result.get_status() == embtl::STATUS::ERROR);
+    REQUIRE(result.has_error());
+    REQUIRE(side_effect_ready::reads == ready_after);
+  }
+  SECTION("counter hook"){
+    side_effect_ready::reset(ready_after, 0x01U);
+    auto result = uut_reg.wait_until<ready_t, embtl::wait::spin, wait_counter_hook>(1U, 1000);
+    REQUIRE(result.get_status() == embtl::STATUS::OK);
+    REQUIRE(wait_counter_hook::iterations == ready_after);
+    REQUIRE(wait_counter_hook::cycles == 10U);
+  }
+}
@@ -0,0 +1,126 @@
+/**
+ * @file uut_embedded_register_array.cpp
+ * @date 2024-10-15
+ * @author Robert Morley
+ *
+ * @brief Unit Test for Embedded Template Library header file "embedded_register_array.hpp"
+ *
+ * @version v1.0.0
+ * @copyright Copyright (c) 2024
+ */
+#include <uut_catch2.hpp>
+#include <embedded_register_array.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+namespace {
+    using register_type = embtl::arch_type;
+    using reg_rw = embtl::basic_hardware_register<embtl::policy::basic_reg_read_write<register_type>, register_type>;
+    using reg_ro = embtl::basic_hardware_register<embtl::policy::basic_reg_read_only<register_type>, register_type>;
+    using reg_reserved = embtl::basic_hardware_register<embtl::policy::basic_reg_reserved<register_type>, register_type>;
+
+    struct dma_channel_registers {
+        reg_rw CCR;
+        reg_rw CNDTR;
+        reg_rw CPAR;
+        reg_rw CMAR;
+        reg_reserved RES;
+    };
+
+    struct dma_register_map {
+        reg_ro ISR;
+        reg_rw IFCR;
+        embtl::register_block_array<dma_channel_registers, 7> CH;
+    };
+
+    struct timer_register_map {
+        reg_rw CTRL;
+        reg_rw CNT;
+        embtl::register_array<reg_rw, 4> CCR;
+        embtl::register_array<reg_rw, 3, 0x10> AF;
+        reg_rw LAST;
+    };
+}
+
+TEST_CASE("Register array : layout","[embtl][register][array][layout]"){
+  STATIC_REQUIRE(std::is_standard_layout_v<timer_register_map>);
+  STATIC_REQUIRE(std::is_standard_layout_v<dma_register_map>);
+
+  STATIC_REQUIRE(offsetof(timer_register_map, CCR) == 0x08);
+  STATIC_REQUIRE(offsetof(timer_register_map, AF) == 0x18);
+  STATIC_REQUIRE(offsetof(timer_register_map, LAST) == 0x48);
+  STATIC_REQUIRE(sizeof(embtl::register_array<reg_rw, 4>) == 4 * sizeof(register_type));
+  STATIC_REQUIRE(decltype(timer_register_map::AF)::stride() == 0x10);
+  STATIC_REQUIRE(decltype(timer_register_map::AF)::size() == 3);
+
+  STATIC_REQUIRE(offsetof(dma_register_map, CH) == 0x08);
+  STATIC_REQUIRE(sizeof(dma_register_map) == 0x08 + 7 * 0x14);
+
+  STATIC_REQUIRE(std::forward_iterator<decltype(std::declval<timer_register_map&>().CCR.begin())>);
+  STATIC_REQUIRE(std::forward_iterator<decltype(std::declval<const dma_register_map&>().CH.begin())>);
+}
+
+TEST_CASE("Register array : register access","[embtl][register][array]"){
+  timer_register_map timer { };
+  const auto* base = reinterpret_cast<const std::byte*>(&timer);
+
+  SECTION("get"){
+    timer.CCR.get<0>() = 0x100;
+    timer.CCR.get<3>() = 0x400;
+    timer.AF.get<2>() = 0xAF;
+
+    REQUIRE(timer.CCR.get<0>().read() == 0x100);
+    REQUIRE(timer.CCR.get<3>().read() == 0x400);
+    REQUIRE(reinterpret_cast<const std::byte*>(&timer.AF.get<2>()) - base == 0x38);
+    REQUIRE(timer.AF.get<2>() == 0xAF);
+  }
+  SECTION("index operator"){
+    for(std::size_t i = 0; i < timer.AF.size(); ++i){
+      timer.AF[i] = static_cast<register_type>(i + 1);
+      REQUIRE(reinterpret_cast<const std::byte*>(&timer.AF[i]) - base == static_cast<std::ptrdiff_t>(0x18 + (i * 0x10)));
+    }
+    REQUIRE(timer.AF.get<0>() == 1);
+    REQUIRE(timer.AF.get<1>() == 2);
+    REQUIRE(timer.AF.get<2>() == 3);
+    REQUIRE(timer.LAST == 0);
+  }
+  SECTION("range iteration"){
+    register_type value { 10 };
+    for(auto& ccr : timer.CCR){
+      ccr = value;
+      value += 10;
+    }
+    REQUIRE(timer.CCR[0] == 10);
+    REQUIRE(timer.CCR[3] == 40);
+
+    const auto& const_timer = timer;
+    register_type sum { 0 };
+    for(const auto& ccr : const_timer.CCR){
+      sum += ccr.read();
+    }
+    REQUIRE(sum == 100);
+    REQUIRE(std::count_if(timer.AF.begin(), timer.AF.end(), [](auto& reg){ return reg == 0U; }) == 3);
+  }
+}
+
+TEST_CASE("Register block array : block access","[embtl][register][array][block]"){
+  dma_register_map dma { };
+  const auto* base = reinterpret_cast<const std::byte*>(&dma);
+
+  dma.CH.get<2>().CNDTR = 0x40;
+  dma.CH[5].CCR |= 0x1U;
+
+  REQUIRE(reinterpret_cast<const std::byte*>(&dma.CH.get<2>().CNDTR) - base == 0x08 + (2 * 0x14) + 0x04);
+  REQUIRE(reinterpret_cast<const std::byte*>(&dma.CH[5].CCR) - base == 0x08 + (5 * 0x14));
+  REQUIRE(dma.CH[2].CNDTR == 0x40);
+  REQUIRE(dma.CH.get<5>().CCR == 0x1);
+
+  std::size_t enabled { 0 };
+  for(auto& channel : dma.CH){
+    if(channel.CCR.get_field(0) != 0){
+      ++enabled;
+    }
+  }
+  REQUIRE(enabled == 1);
+}
@@ -0,0 +1,253 @@
+/**
+ * @file uut_embedded_ring.cpp
+ * @date 2024-10-17
+ * @author Robert Morley
+ *
+ * @brief
+ *
+ * @version v0.1.0
+ * @copyright Copyright (c) 2024
+ */
+#include <atomic>
+#include <numeric>
+#include <thread>
+#include <vector>
+#include <uut_catch2.hpp>
+#include <embedded_ring.hpp>
+
+namespace {
+    struct can_frame_t {
+        std::uint32_t id;
+        std::uint8_t length;
+        std::array<std::uint8_t, 8> data;
+    };
+}
+
+TEMPLATE_TEST_CASE_SIG("basic_spsc_ring<> template test", "[embtl][template][ring]",
+                       ((std::size_t N), N), (1), (2), (8), (64)
+){
+  using ring_t = embtl::basic_spsc_ring<std::uint32_t, N>;
+  ring_t ring;
+
+  STATIC_REQUIRE(ring_t::capacity() == N);
+  STATIC_REQUIRE(alignof(ring_t) == embtl::cache_line_size);
+
+  SECTION("push and pop"){
+    REQUIRE(ring.empty());
+    for(std::uint32_t i = 0; i < N; ++i){
+      REQUIRE(ring.push(i));
+    }
+    REQUIRE(ring.full());
+    REQUIRE_FALSE(ring.push(0xFFFF'FFFF));
+
+    std::uint32_t value = 0;
+    for(std::uint32_t i = 0; i < N; ++i){
+      REQUIRE(ring.pop(value));
+      REQUIRE(value == i);
+    }
+    REQUIRE_FALSE(ring.pop(value));
+    REQUIRE(ring.empty());
+  }
+  SECTION("Wrap around"){
+    std::uint32_t next_in = 0;
+    std::uint32_t next_out = 0;
+    std::uint32_t value = 0;
+
+    for(std::size_t round = 0; round < 5 * N; ++round){
+      REQUIRE(ring.push(next_in++));
+      if(round % 3 != 0 || ring.full()){
+        REQUIRE(ring.pop(value));
+        REQUIRE(value == next_out++);
+      }
+      REQUIRE(ring.size() == next_in - next_out);
+    }
+  }
+  SECTION("Bulk push_n and pop_n"){
+    std::vector<std::uint32_t> in(N + 3);
+    std::iota(in.begin(), in.end(), 100U);
+    std::vector<std::uint32_t> out(N + 3, 0);
+
+    for(std::size_t round = 0; round < 4; ++round){
+      const auto offset = std::min<std::size_t>(round, N - 1);
+      REQUIRE(ring.push_n(std::span<const std::uint32_t>(in).first(offset)) == offset);
+      REQUIRE(ring.pop_n(std::span<std::uint32_t>(out).first(offset)) == offset);
+
+      REQUIRE(ring.push_n(in) == N);
+      REQUIRE(ring.full());
+      REQUIRE(ring.pop_n(out) == N);
+      REQUIRE(std::equal(out.begin(), out.begin() + static_cast<std::ptrdiff_t>(N), in.begin()));
+      REQUIRE(ring.pop_n(out) == 0);
+    }
+  }
+}
+
+TEST_CASE("basic_spsc_ring<> thread test", "[embtl][template][ring][thread]"){
+  constexpr std::uint32_t frames = 50'000;
+  embtl::basic_spsc_ring<can_frame_t, 64> ring;
+  std::atomic<bool> done { false };
+  std::size_t largest = 0;
+
+  std::thread observer([&ring, &done, &largest](){
+    while(!done.load(std::memory_order_acquire)){
+      largest = std::max(largest, ring.size());
+      std::this_thread::yield();
+    }
+  });
+  std::thread producer([&ring](){
+    std::array<can_frame_t, 5> burst { };
+    std::uint32_t id = 0;
+    while(id < frames){
+      if(id % 3 == 0){
+        const can_frame_t frame { id, static_cast<std::uint8_t>(id % 9), { static_cast<std::uint8_t>(id) } };
+        if(ring.push(frame)){
+          ++id;
+        } else {
+          std::this_thread::yield();
+        }
+      } else {
+        const auto n = std::min<std::uint32_t>(static_cast<std::uint32_t>(burst.size()), frames - id);
+        for(std::uint32_t i = 0; i < n; ++i){
+          burst[i] = { id + i, static_cast<std::uint8_t>((id + i) % 9), { static_cast<std::uint8_t>(id + i) } };
+        }
+        const auto pushed = ring.push_n(std::span<const can_frame_t>(burst).first(n));
+        if(pushed == 0){
+          std::this_thread::yield();
+        }
+        id += static_cast<std::uint32_t>(pushed);
+      }
+    }
+  });
+
+  std::uint32_t expected = 0;
+  std::size_t errors = 0;
+  std::array<can_frame_t, 7> batch { };
+  while(expected < frames){
+    const auto n = ring.pop_n(batch);
+    if(n == 0){
+      std::this_thread::yield();
+    }
+    for(std::size_t i = 0; i < n; ++i){
+      const auto& frame = batch[i];
+      if(frame.id != expected || frame.length != expected % 9 || frame.data[0] != static_cast<std::uint8_t>(expected)){
+        ++errors;
+      }
+      ++expected;
+    }
+  }
+  producer.join();
+  done.store(true, std::memory_order_release);
+  observer.join();
+
+  REQUIRE(errors == 0);
+  REQUIRE(ring.empty());
+  REQUIRE(largest <= ring.capacity());
+}
+
+TEMPLATE_TEST_CASE_SIG("basic_mpmc_queue<> template test", "[embtl][template][ring][mpmc]",
+                       ((std::size_t N), N), (2), (4), (8), (64)
+){
+  using queue_t = embtl::basic_mpmc_queue<std::uint32_t, N>;
+  queue_t queue;
+
+  STATIC_REQUIRE(queue_t::capacity() == N);
+  STATIC_REQUIRE(alignof(queue_t) == embtl::cache_line_size);
+
+  SECTION("push and pop"){
+    REQUIRE(queue.empty());
+    for(std::uint32_t i = 0; i < N; ++i){
+      const auto result = queue.push(i);
+      REQUIRE(result == embtl::STATUS::OK);
+      REQUIRE(result.get_value() == i);
+    }
+    REQUIRE(queue.size() == N);
+    REQUIRE(queue.push(0xFFFF'FFFF) == embtl::STATUS::BUFFER_OVERFLOW);
+    REQUIRE(queue.push(0xFFFF'FFFF).has_error());
+
+    std::uint32_t value = 0;
+    for(std::uint32_t i = 0; i < N; ++i){
+      REQUIRE(queue.pop(value) == embtl::STATUS::OK);
+      REQUIRE(value == i);
+    }
+    REQUIRE(queue.pop(value) == embtl::STATUS::NOT_AVAILABLE);
+    REQUIRE(queue.empty());
+  }
+  SECTION("Wrap around"){
+    std::uint32_t next_in = 0;
+    std::uint32_t next_out = 0;
+    std::uint32_t value = 0;
+
+    for(std::size_t round = 0; round < 5 * N; ++round){
+      REQUIRE(queue.push(next_in++) == embtl::STATUS::OK);
+      if(round % 3 != 0 || queue.size() == N){
+        const auto result = queue.pop(value);
+        REQUIRE(result == embtl::STATUS::OK);
+        REQUIRE(result.get_value() == next_out);
+        REQUIRE(value == next_out++);
+      }
+      REQUIRE(queue.size() == next_in - next_out);
+    }
+  }
+}
+
+TEST_CASE("basic_mpmc_queue<> constant initialization test", "[embtl][template][ring][mpmc]"){
+  static constinit embtl::basic_mpmc_queue<can_frame_t, 4> queue;
+
+  REQUIRE(queue.push({ 0x123, 2, { 0xAA, 0x55 } }) == embtl::STATUS::OK);
+  can_frame_t frame { };
+  REQUIRE(queue.pop(frame) == embtl::STATUS::OK);
+  REQUIRE(frame.id == 0x123);
+  REQUIRE(frame.data[1] == 0x55);
+}
+
+TEST_CASE("basic_mpmc_queue<> thread stress test", "[embtl][template][ring][mpmc][thread]"){
+  constexpr std::uint32_t items = 4'000;
+  const auto threads = GENERATE(1U, 2U, 4U, 8U, 16U);
+  embtl::basic_mpmc_queue<std::uint64_t, 32> queue;
+
+  std::atomic<std::uint32_t> received { 0 };
+  std::vector<std::uint64_t> sums(threads, 0);
+  std::vector<std::size_t> errors(threads, 0);
+  std::vector<std::thread> workers;
+
+  for(std::uint32_t producer = 0; producer < threads; ++producer){
+    workers.emplace_back([&queue, producer](){
+      for(std::uint32_t i = 0; i < items; ){
+        if(queue.push((std::uint64_t{producer} << 32) | i).has_value()){
+          ++i;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for(std::uint32_t consumer = 0; consumer < threads; ++consumer){
+    workers.emplace_back([&, consumer](){
+      std::vector<std::int64_t> last(threads, -1);
+      std::uint64_t value = 0;
+      while(received.load(std::memory_order_relaxed) < threads * items){
+        if(queue.pop(value).has_error()){
+          std::this_thread::yield();
+          continue;
+        }
+        received.fetch_add(1, std::memory_order_relaxed);
+        const std::size_t producer = value >> 32;
+        const auto sequence = static_cast<std::int64_t>(value & 0xFFFF'FFFF);
+        if(producer >= threads || sequence <= last[producer]){
+          ++errors[consumer];
+        } else {
+          last[producer] = sequence;
+        }
+        sums[consumer] += value & 0xFFFF'FFFF;
+      }
+    });
+  }
+  for(auto& worker : workers){
+    worker.join();
+  }
+
+  const auto per_producer = std::uint64_t{items} * (items - 1) / 2;
+  REQUIRE(std::accumulate(errors.begin(), errors.end(), std::size_t{0}) == 0);
+  REQUIRE(std::accumulate(sums.begin(), sums.end(), std::uint64_t{0}) == per_producer * threads);
+  REQUIRE(received.load() == threads * items);
+  REQUIRE(queue.empty());
+}
@@ -0,0 +1,264 @@
+/**
+ * @file uut_embedded_transaction.cpp
+ * @date 2024-10-12
+ * @author Robert Morley
+ *
+ * @brief Unit Test : Embedded Template Library := register_transaction<> template test.
+ *
+ * @version v0.1.0
+ * @copyright Copyright (c) 2024
+ */
+#include <vector>
+#include <uut_catch2.hpp>
+#include <embedded_allocator.hpp>
+#include <embedded_transaction.hpp>
+
+namespace {
+    /**
+     * @brief Side effect that records the address of every register write and counts register reads.
+     */
+    struct transaction_side_effect final {
+      public:
+        template<typename T>
+        static void read(volatile T&){
+          ++reads;
+        }
+        template<typename T, typename V>
+        static void write(volatile T& reg, V&& value){
+          writes.push_back(&reg);
+          reg = static_cast<T>(value);                                    // narrow registers are written with the promoted value.
+        }
+        static void reset() noexcept {
+          reads = 0;
+          writes.clear();
+        }
+
+        inline static std::size_t reads { 0 };
+        inline static std::vector<volatile void*> writes { };
+    };
+
+    template<embtl::arch_type Mask = std::numeric_limits<embtl::arch_type>::max(),
+             embtl::arch_type Reset = std::numeric_limits<embtl::arch_type>::min()>
+    using tx_reg_rw_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_write<embtl::arch_type, Mask, transaction_side_effect>,
+                                                       embtl::arch_type, Mask, Reset>;
+    template<embtl::arch_type Mask = std::numeric_limits<embtl::arch_type>::max(),
+             embtl::arch_type Reset = std::numeric_limits<embtl::arch_type>::min()>
+    using tx_reg_wo_t = embtl::basic_hardware_register<embtl::policy::basic_reg_write_only<embtl::arch_type, Mask, transaction_side_effect>,
+                                                       embtl::arch_type, Mask, Reset>;
+    using tx_reg_ro_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_only<embtl::arch_type, transaction_side_effect>>;
+
+    struct timer_registers_t {
+        tx_reg_rw_t<>                 CR1;
+        tx_reg_rw_t<0x0000'FFFF>      CR2;
+        tx_reg_ro_t                   SR;
+        tx_reg_wo_t<>                 CNT;
+        tx_reg_wo_t<0xFFFF, 0x00A5>   PSC;
+        tx_reg_rw_t<>                 ARR;
+    };
+
+    template<typename T>
+    using tx_narrow_rw_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_write<T, std::numeric_limits<T>::max(), transaction_side_effect>, T>;
+
+    struct narrow_registers_t {
+        tx_narrow_rw_t<std::uint8_t>  CTRL;
+        tx_narrow_rw_t<std::uint8_t>  STAT;
+        tx_narrow_rw_t<std::uint16_t> DIV;
+        tx_reg_rw_t<>                 DATA;
+    };
+
+    using tim_en_t = embtl::field<0>;
+    using tx_reg_w1c_t = embtl::basic_hardware_register<embtl::policy::basic_reg_write_1_clear<embtl::arch_type>>;
+
+    struct status_registers_t {
+        tx_reg_rw_t<>                 CR;
+        tx_reg_w1c_t                  SR;
+    };
+
+    using tim_dir_t = embtl::field<4>;
+    using tim_cms_t = embtl::field<5, 2>;
+    using tim_ckd_t = embtl::field<8, 2>;
+}
+
+TEST_CASE("register_transaction<> template test", "[embtl][template][transaction]"){
+  using tx_t = embtl::register_transaction<timer_registers_t>;
+
+  timer_registers_t regs { };
+  auto init_value = GENERATE(take(10, random(std::numeric_limits<embtl::arch_type>::min(), std::numeric_limits<embtl::arch_type>::max())));
+  auto value = GENERATE(take(5, random(std::numeric_limits<embtl::arch_type>::min(), std::numeric_limits<embtl::arch_type>::max())));
+
+  tx_reg_rw_t<>::set_register(regs.CR1, init_value);
+  tx_reg_rw_t<0x0000'FFFF>::set_register(regs.CR2, init_value & 0x0000'FFFF);
+  tx_reg_rw_t<>::set_register(regs.ARR, init_value);
+  transaction_side_effect::reset();
+
+  SECTION("Compile Time Tests"){
+    STATIC_REQUIRE(embtl::register_map_member<&timer_registers_t::CR1, timer_registers_t>);
+    STATIC_REQUIRE(std::is_same_v<embtl::register_member_t<&timer_registers_t::PSC>, tx_reg_wo_t<0xFFFF, 0x00A5>>);
+
+    using region_t = embtl::basic_device_region<timer_registers_t, embtl::basic_mmio_single_device_allocator<{0x4000'0000}>>;
+    STATIC_REQUIRE(std::is_same_v<decltype(embtl::register_transaction { std::declval<region_t&>() }), tx_t>);
+  }
+  SECTION("Writes are deferred until commit"){
+    tx_t tx { regs };
+
+    tx.write<&timer_registers_t::ARR>(value);
+    tx.set<&timer_registers_t::CR1, tim_en_t>(1);
+
+    REQUIRE(tx.pending() == 2);
+    REQUIRE(transaction_side_effect::writes.empty());
+    REQUIRE(tx_reg_rw_t<>::get_register(regs.ARR) == init_value);
+
+    tx.commit();
+
+    REQUIRE(tx.pending() == 0);
+    REQUIRE(transaction_side_effect::writes.size() == 2);
+    REQUIRE(tx_reg_rw_t<>::get_register(regs.ARR) == value);
+    REQUIRE(tx_reg_rw_t<>::get_register(regs.CR1) == (init_value | 0x1U));
+  }
+  SECTION("Repeated writes are collapsed"){
+    {
+      tx_t tx { regs };
+
+      tx.set<&timer_registers_t::CR1, tim_en_t>(1);
+      tx.set<&timer_registers_t::CR1, tim_dir_t>(1);
+      tx.modify<&timer_registers_t::CR1>(tim_cms_t{} = 2, tim_ckd_t{} = 1);
+      tx.clear<&timer_registers_t::CR1, tim_en_t>();
+      tx.write<&timer_registers_t::CNT>(0);
+      tx.write<&timer_registers_t::CNT>(value);
+      tx.modify<&timer_registers_t::PSC>(embtl::field<0, 4>{} = 0xFU);
+
+      REQUIRE(tx.pending() == 3);
+    } // commit on destruction
+
+    auto cr1_check = init_value & ~embtl::static_mask<embtl::arch_type, {0}, {4}, {5, 2}, {8, 2}>;
+    cr1_check |= (0x1U << 4) | (0x2U << 5) | (0x1U << 8);
+
+    REQUIRE(transaction_side_effect::reads == 1);                    // CR1 loaded once, PSC starts from reset value.
+    REQUIRE(transaction_side_effect::writes.size() == 3);
+    REQUIRE(tx_reg_rw_t<>::get_register(regs.CR1) == cr1_check);
+    REQUIRE(tx_reg_wo_t<>::get_register(regs.CNT) == value);
+    REQUIRE(tx_reg_wo_t<0xFFFF, 0x00A5>::get_register(regs.PSC) == 0x00AFU);
+  }
+  SECTION("Commit order"){
+    auto address = [](auto& reg) { return static_cast<volatile void*>(&reg); };
+    tx_t tx { regs };
+
+    tx.write<&timer_registers_t::ARR>(value);
+    tx.write<&timer_registers_t::CNT>(value);
+    tx.write<&timer_registers_t::CR2>(value);
+    tx.write<&timer_registers_t::CR1>(value);
+
+    SECTION("Declaration order"){
+      tx.commit();
+
+      REQUIRE(transaction_side_effect::writes.size() == 4);
+      REQUIRE(transaction_side_effect::writes[0] == address(regs.CR1));
+      REQUIRE(transaction_side_effect::writes[1] == address(regs.CR2));
+      REQUIRE(transaction_side_effect::writes[2] == address(regs.CNT));
+      REQUIRE(transaction_side_effect::writes[3] == address(regs.ARR));
+    }
+    SECTION("Chosen order"){
+      tx.commit<&timer_registers_t::ARR, &timer_registers_t::CR2>();
+
+      REQUIRE(transaction_side_effect::writes.size() == 4);
+      REQUIRE(transaction_side_effect::writes[0] == address(regs.ARR));
+      REQUIRE(transaction_side_effect::writes[1] == address(regs.CR2));
+      REQUIRE(transaction_side_effect::writes[2] == address(regs.CR1));
+      REQUIRE(transaction_side_effect::writes[3] == address(regs.CNT));
+    }
+    SECTION("Discard"){
+      tx.discard();
+      tx.commit();
+
+      REQUIRE(transaction_side_effect::writes.empty());
+      REQUIRE(tx_reg_rw_t<>::get_register(regs.ARR) == init_value);
+    }
+  }
+}
+
+TEST_CASE("register_transaction<> narrow register test", "[embtl][template][transaction]"){
+  using tx_t = embtl::register_transaction<narrow_registers_t>;
+
+  narrow_registers_t regs { };
+  auto value = GENERATE(take(10, random(std::numeric_limits<std::uint16_t>::min(), std::numeric_limits<std::uint16_t>::max())));
+  auto address = [](auto& reg) { return static_cast<volatile void*>(&reg); };
+
+  tx_narrow_rw_t<std::uint8_t>::set_register(regs.STAT, 0xA5U);
+  transaction_side_effect::reset();
+
+  SECTION("Compile Time Tests"){
+    STATIC_REQUIRE(sizeof(narrow_registers_t) == 8);
+    STATIC_REQUIRE(std::is_same_v<decltype(std::declval<tx_t&>().write<&narrow_registers_t::DIV>(0)), void>);
+  }
+  SECTION("Registers are staged in their own width"){
+    {
+      tx_t tx { regs };
+
+      tx.write<&narrow_registers_t::DIV>(value);
+      tx.write<&narrow_registers_t::DATA>(0xDEAD'BEEFU);
+      tx.modify<&narrow_registers_t::STAT>(embtl::field<0, 4>{} = 0x3U);
+      tx.set<&narrow_registers_t::CTRL, embtl::field<7>>(1);
+
+      REQUIRE(tx.pending() == 4);
+      REQUIRE(transaction_side_effect::writes.empty());
+    } // commit on destruction
+
+    REQUIRE(transaction_side_effect::reads == 2);
+    REQUIRE(transaction_side_effect::writes.size() == 4);
+    REQUIRE(transaction_side_effect::writes[0] == address(regs.CTRL));
+    REQUIRE(transaction_side_effect::writes[1] == address(regs.STAT));
+    REQUIRE(transaction_side_effect::writes[2] == address(regs.DIV));
+    REQUIRE(transaction_side_effect::writes[3] == address(regs.DATA));
+    REQUIRE(tx_narrow_rw_t<std::uint8_t>::get_register(regs.CTRL) == 0x80U);
+    REQUIRE(tx_narrow_rw_t<std::uint8_t>::get_register(regs.STAT) == 0xA3U);
+    REQUIRE(tx_narrow_rw_t<std::uint16_t>::get_register(regs.DIV) == value);
+    REQUIRE(tx_reg_rw_t<>::get_register(regs.DATA) == 0xDEAD'BEEFU);
+  }
+  SECTION("Neighbouring narrow registers are not overwritten"){
+    tx_t tx { regs };
+
+    tx.write<&narrow_registers_t::CTRL>(0x5AU);
+    tx.commit<&narrow_registers_t::CTRL>();
+
+    REQUIRE(transaction_side_effect::writes.size() == 1);
+    REQUIRE(tx_narrow_rw_t<std::uint8_t>::get_register(regs.CTRL) == 0x5AU);
+    REQUIRE(tx_narrow_rw_t<std::uint8_t>::get_register(regs.STAT) == 0xA5U);
+    REQUIRE(tx_narrow_rw_t<std::uint16_t>::get_register(regs.DIV) == 0);
+  }
+}
+
+TEST_CASE("register_transaction<> write-one-to-clear test", "[embtl][template][transaction][w1c]"){
+  using tx_t = embtl::register_transaction<status_registers_t>;
+  using flag0_t = embtl::field<1>;
+  using flag1_t = embtl::field<2>;
+
+  status_registers_t regs { };
+  tx_reg_w1c_t::set_register(regs.SR, 0x0000'0006U);       // two flags pending.
+  transaction_side_effect::reset();
+
+  SECTION("Only the cleared flags are written"){
+    {
+      tx_t tx { regs };
+
+      tx.clear<&status_registers_t::SR, flag0_t>();
+      tx.write<&status_registers_t::CR>(0x1U);
+
+      REQUIRE(tx.is_pending<&status_registers_t::SR>());
+      REQUIRE(tx.get<&status_registers_t::SR>() == 0x0000'0002U);
+    } // commit on destruction
+
+    REQUIRE(tx_reg_w1c_t::get_register(regs.SR) == 0x0000'0004U);
+    REQUIRE(tx_reg_rw_t<>::get_register(regs.CR) == 0x1U);
+  }
+  SECTION("Flags cleared by several calls"){
+    tx_t tx { regs };
+
+    tx.clear<&status_registers_t::SR, flag0_t>();
+    tx.clear<&status_registers_t::SR, flag1_t>();
+    REQUIRE(tx.get<&status_registers_t::SR>() == 0x0000'0006U);
+    REQUIRE(tx_reg_w1c_t::get_register(regs.SR) == 0x0000'0006U);
+
+    tx.commit();
+    REQUIRE(tx_reg_w1c_t::get_register(regs.SR) == 0);
+  }
+}
@@ -0,0 +1,34 @@
+/**
+ * @file target_embedded_driver.cpp
+ * @date 2024-08-12
+ * @author Robert Morley
+ *
+ * @brief Compile only checks built without UNIT_TEST, where host_allocation is the target type.
+ *
+ * @version v0.1.0
+ * @copyright Copyright (c) 2024
+ */
+#include <embedded_driver.hpp>
+#include <embedded_allocator.hpp>
+#include <embedded_register.hpp>
+
+#if defined(UNIT_TEST)
+#error "target_embedded_driver.cpp must be built without UNIT_TEST"
+#endif
+
+namespace {
+    using drv_reg_rw_t = embtl::basic_hardware_register<embtl::policy::basic_reg_read_write<embtl::arch_type>>;
+
+    struct rcc_registers_t {
+        drv_reg_rw_t CR;
+        drv_reg_rw_t CFGR;
+    };
+
+    using rcc_target_region_t = embtl::basic_device_region<rcc_registers_t, embtl::basic_mmio_single_device_allocator<{0x4002'1000}, embtl::host_allocation>>;
+
+    static_assert(!std::is_same_v<embtl::host_allocation, std::false_type>);
+    static_assert(!embtl::host_allocation::value);
+    static_assert(embtl::static_device_region<rcc_target_region_t>);
+    static_assert(std::is_same_v<embtl::driver_base_t<rcc_target_region_t>, embtl::static_driver<rcc_target_region_t>>);
+    static_assert(embtl::static_driver<rcc_target_region_t>::base_address == 0x4002'1000);
+}